@@ -0,0 +1,75 @@
+#pragma once
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Benchmarks
+{
+    // Subjects are prepared per run outside the measurement, so Attach inserts observers the subject does not hold yet,
+    // Detach removes attached ones and Churn replaces 10% of the attached observers with new ones, like one frame.
+    // observers holds the attachedCount observers followed by the 10% attached by Churn. Works for any subject with
+    // AttachObserver/DetachObserver taking an Observer*, reference and value semantics alike.
+    template<typename SubjectSystemT>
+    void BenchmarkAttachDetach(const std::string& suffix,
+        const std::vector<std::shared_ptr<typename SubjectSystemT::Observer>>& observers, const size_t attachedCount)
+    {
+        const size_t churnCount{attachedCount / 10};
+        const auto prepareSubjects{
+            [&observers, attachedCount](const int runs)
+            {
+                std::vector<SubjectSystemT> subjects(static_cast<size_t>(runs));
+                for(SubjectSystemT& subject : subjects)
+                {
+                    for(size_t i{0}; i != attachedCount; ++i)
+                    {
+                        subject.AttachObserver(observers[i].get());
+                    }
+                }
+
+                return subjects;
+            }};
+
+        BENCHMARK_ADVANCED("Benchmark Attach" + suffix)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<SubjectSystemT> subjects(static_cast<size_t>(meter.runs()));
+            meter.measure(
+                [&subjects, &observers, attachedCount](const int run)
+                {
+                    for(size_t i{0}; i != attachedCount; ++i)
+                    {
+                        subjects[run].AttachObserver(observers[i].get());
+                    }
+                });
+        };
+
+        BENCHMARK_ADVANCED("Benchmark Detach" + suffix)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<SubjectSystemT> subjects{prepareSubjects(meter.runs())};
+            meter.measure(
+                [&subjects, &observers, attachedCount](const int run)
+                {
+                    for(size_t i{0}; i != attachedCount; ++i)
+                    {
+                        subjects[run].DetachObserver(observers[i].get());
+                    }
+                });
+        };
+
+        BENCHMARK_ADVANCED("Benchmark Churn 10%" + suffix)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<SubjectSystemT> subjects{prepareSubjects(meter.runs())};
+            meter.measure(
+                [&subjects, &observers, attachedCount, churnCount](const int run)
+                {
+                    for(size_t i{0}; i != churnCount; ++i)
+                    {
+                        subjects[run].DetachObserver(observers[i].get());
+                        subjects[run].AttachObserver(observers[attachedCount + i].get());
+                    }
+                });
+        };
+    }
+}
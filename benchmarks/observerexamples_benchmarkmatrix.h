@@ -0,0 +1,157 @@
+#pragma once
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../referencesemantics/observerexamples_referencesemantics.h"
+#include "../valuesemantics/observerexamples_valuesemantics.h"
+
+// Sweeps observer counts, storage policies, callable kinds and tag selectivity. Hidden behind the [.benchmark-matrix]
+// tag as the 1M observer runs take minutes, run it with the XML reporter to track results between releases, Catch2's
+// JSON reporter does not write benchmark results:
+// observer-pattern.exe "[.benchmark-matrix]" --reporter XML::out=benchmark-matrix.xml
+namespace BenchmarkMatrix
+{
+    constexpr std::array<uint32_t, 7> observerCounts{1, 10, 100, 1'000, 10'000, 100'000, 1'000'000};
+    constexpr std::array<uint32_t, 4> subscribedPercentages{100, 50, 10, 1};
+    constexpr uint32_t selectivityObserverCount{100'000};
+
+    inline std::string GetBenchmarkName(const std::string& operation, const std::string& callable,
+        const std::string& storage, const uint32_t observerCount)
+    {
+        return operation + " - " + callable + " - " + storage + " - " + std::to_string(observerCount) + " Observers";
+    }
+
+    // Notify visits every observer, Detach/Attach removes and re-adds the middle observer so the count is unchanged.
+    template<typename SubjectSystemT>
+    void BenchmarkReferenceSemantics(const std::string& storage)
+    {
+        using ObserverA = ReferenceSemantics::BasicSubjectObserverA<SubjectSystemT>;
+
+        for(const uint32_t observerCount : observerCounts)
+        {
+            SubjectSystemT subject{};
+            std::vector<std::unique_ptr<ObserverA>> observers{};
+            observers.reserve(observerCount);
+            for(uint32_t i{0}; i != observerCount; ++i)
+            {
+                observers.push_back(std::make_unique<ObserverA>());
+                subject.AttachObserver(observers.back().get());
+            }
+
+            BENCHMARK(GetBenchmarkName("Notify", "Virtual", storage, observerCount))
+            {
+                subject.SetValueA(0);
+            };
+
+            ObserverA* const churnObserver{observers[observerCount / 2].get()};
+            BENCHMARK(GetBenchmarkName("Detach/Attach", "Virtual", storage, observerCount))
+            {
+                subject.DetachObserver(churnObserver);
+                return subject.AttachObserver(churnObserver);
+            };
+        }
+    }
+
+    // The notified tag only reaches the subscribed share of the observers, the rest are attached to the other tag.
+    template<typename SubjectSystemT>
+    void BenchmarkTagSelectivity(const std::string& storage)
+    {
+        using ObserverA = ReferenceSemantics::BasicSubjectObserverA<SubjectSystemT>;
+
+        for(const uint32_t percentage : subscribedPercentages)
+        {
+            SubjectSystemT subject{};
+            std::vector<std::unique_ptr<ObserverA>> observers{};
+            observers.reserve(selectivityObserverCount);
+            for(uint32_t i{0}; i != selectivityObserverCount; ++i)
+            {
+                observers.push_back(std::make_unique<ObserverA>());
+                subject.AttachObserver(observers.back().get(), i % 100 < percentage
+                    ? ReferenceSemantics::SubjectSystemTag::ValueA : ReferenceSemantics::SubjectSystemTag::ValueB);
+            }
+
+            BENCHMARK(GetBenchmarkName("Notify", "Virtual", storage, selectivityObserverCount) + " - "
+                + std::to_string(percentage) + "% Subscribed")
+            {
+                subject.SetValueA(0);
+            };
+        }
+    }
+
+    template<typename SubjectSystemT>
+    void BenchmarkValueSemantics(const std::string& callable, const std::string& function,
+        const typename SubjectSystemT::Observer& prototype)
+    {
+        using Observer = typename SubjectSystemT::Observer;
+
+        for(const uint32_t observerCount : observerCounts)
+        {
+            SubjectSystemT subject{};
+            std::vector<std::unique_ptr<Observer>> observers{};
+            observers.reserve(observerCount);
+            for(uint32_t i{0}; i != observerCount; ++i)
+            {
+                observers.push_back(std::make_unique<Observer>(prototype));
+                subject.AttachObserver(observers.back().get());
+            }
+
+            BENCHMARK(GetBenchmarkName("Notify", callable, function, observerCount))
+            {
+                subject.SetValueA(0);
+            };
+
+            Observer* const churnObserver{observers[observerCount / 2].get()};
+            BENCHMARK(GetBenchmarkName("Detach/Attach", callable, function, observerCount))
+            {
+                subject.DetachObserver(churnObserver);
+                subject.AttachObserver(churnObserver);
+            };
+        }
+    }
+
+    TEST_CASE("Observer - Benchmark Matrix - Reference Semantics", "[.benchmark-matrix]")
+    {
+        BenchmarkReferenceSemantics<ReferenceSemantics::SubjectSystem>("Set Storage");
+        BenchmarkReferenceSemantics<ReferenceSemantics::VectorSubjectSystem>("Vector Storage");
+        BenchmarkReferenceSemantics<ReferenceSemantics::TypeGroupedSubjectSystem>("Type Grouped Storage");
+        BenchmarkReferenceSemantics<ReferenceSemantics::PrioritySubjectSystem>("Priority Storage");
+    }
+
+    TEST_CASE("Observer - Benchmark Matrix - Tag Selectivity", "[.benchmark-matrix]")
+    {
+        BenchmarkTagSelectivity<ReferenceSemantics::SubjectSystem>("Set Storage");
+        BenchmarkTagSelectivity<ReferenceSemantics::VectorSubjectSystem>("Vector Storage");
+    }
+
+    TEST_CASE("Observer - Benchmark Matrix - Value Semantics", "[.benchmark-matrix]")
+    {
+        int32_t value{0};
+        const auto lambda{
+            [&value]<typename SubjectSystemT>(const SubjectSystemT& subject, const ValueSemantics::SubjectSystemTag tag)
+            {
+                if(tag == ValueSemantics::SubjectSystemTag::ValueA)
+                {
+                    value = subject.GetValueA();
+                    return true;
+                }
+
+                return false;
+            }};
+
+        BenchmarkValueSemantics<ValueSemantics::SubjectSystem>("Lambda", "Inplace Function",
+            ValueSemantics::SubjectSystem::Observer{lambda});
+        BenchmarkValueSemantics<ValueSemantics::StdFunctionSubjectSystem>("Lambda", "std::function",
+            ValueSemantics::StdFunctionSubjectSystem::Observer{lambda});
+        BenchmarkValueSemantics<ValueSemantics::SubjectSystem>("Free Function", "Inplace Function",
+            ValueSemantics::SubjectSystem::Observer{ValueSemantics::OnNotification<ValueSemantics::SubjectSystem>});
+        BenchmarkValueSemantics<ValueSemantics::StdFunctionSubjectSystem>("Free Function", "std::function",
+            ValueSemantics::StdFunctionSubjectSystem::Observer{
+                ValueSemantics::OnNotification<ValueSemantics::StdFunctionSubjectSystem>});
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <utility>
+
+#include "../referencesemantics/observerexamples_observerpool.h"
+
+namespace Benchmarks
+{
+    // Observer count shared by the notification benchmarks, large enough for the dispatch loop to dominate.
+    constexpr size_t NotificationObserverCount{250'000};
+
+    // Creates observers contiguously from an ObserverPool, so the notification benchmarks measure dispatch rather than
+    // observers scattered through the heap. The observers are destroyed with the factory.
+    template<typename ObserverT>
+    class PooledObserverFactory
+    {
+    public:
+        template<typename... ArgsT>
+        ObserverT* Create(ArgsT&&... args)
+        {
+            m_Observers.push_back(m_Pool->Create(std::forward<ArgsT>(args)...));
+            return m_Observers.back();
+        }
+
+        ObserverT* operator[](const size_t index) const { return m_Observers[index]; }
+        size_t Size() const { return m_Observers.size(); }
+    private:
+        std::unique_ptr<ReferenceSemantics::ObserverPool<ObserverT>> m_Pool{
+            std::make_unique<ReferenceSemantics::ObserverPool<ObserverT>>()};
+        std::vector<ObserverT*> m_Observers{};
+    };
+
+    // Creates observerCount observers of ObserverT and attaches each one to subject through attach, which receives the
+    // subject, the observer and its index. The returned factory keeps the observers alive for the benchmarks using
+    // subject.
+    template<typename ObserverT, typename SubjectSystemT, typename AttachT>
+    PooledObserverFactory<ObserverT> CreateAttachedObservers(
+        SubjectSystemT& subject, const size_t observerCount, AttachT&& attach)
+    {
+        PooledObserverFactory<ObserverT> observers{};
+        for(size_t i{0}; i != observerCount; ++i)
+        {
+            attach(subject, observers.Create(), i);
+        }
+
+        return observers;
+    }
+
+    template<typename ObserverT, typename SubjectSystemT>
+    PooledObserverFactory<ObserverT> CreateAttachedObservers(
+        SubjectSystemT& subject, const size_t observerCount = NotificationObserverCount)
+    {
+        return CreateAttachedObservers<ObserverT>(subject, observerCount,
+            [](SubjectSystemT& attachSubject, ObserverT* const observer, size_t)
+            {
+                attachSubject.AttachObserver(observer);
+            });
+    }
+}
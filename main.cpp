@@ -1,7 +1,17 @@
 #include <catch2/catch_session.hpp>
 
 #include "referencesemantics/observerexamples_referencesemantics.h"
+#include "referencesemantics/observerexamples_staticsubject.h"
+#include "referencesemantics/observerexamples_workstealingthreadpool.h"
+#include "referencesemantics/observerexamples_queuedsubject.h"
+#include "referencesemantics/observerexamples_concurrentsubject.h"
+#include "referencesemantics/observerexamples_intrusivesubject.h"
+#include "referencesemantics/observerexamples_observerpool.h"
+#include "referencesemantics/observerexamples_computed.h"
+#include "referencesemantics/observerexamples_propagationengine.h"
+#include "referencesemantics/observerexamples_shardedsubject.h"
 #include "valuesemantics/observerexamples_valuesemantics.h"
+#include "benchmarks/observerexamples_benchmarkmatrix.h"
 
 int main(const int argc, const char* const argv[])
 {
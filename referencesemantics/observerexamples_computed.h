@@ -0,0 +1,193 @@
+#pragma once
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <concepts>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "observerexamples_referencesemantics.h"
+
+namespace ReferenceSemantics
+{
+    // Value derived from a subject, attached to the subject's tags for its lifetime. A notification only marks it dirty,
+    // Get recomputes it if it is dirty, so sets that are never read cost no recomputation.
+    // The subject must outlive the Computed.
+    template<typename SubjectT, std::invocable<const SubjectT&> ComputeT>
+    class Computed final : public SubjectT::Observer
+    {
+    public:
+        using Tag = typename SubjectT::Tag;
+        using TagSet = typename SubjectT::TagSet;
+        using Value = std::remove_cvref_t<std::invoke_result_t<ComputeT&, const SubjectT&>>;
+
+        Computed(SubjectT& subject, const TagSet tags, ComputeT compute)
+            : m_Subject{subject}
+            , m_Compute{std::move(compute)}
+            , m_Tags{tags}
+        {
+            m_Subject.AttachObserver(this, m_Tags);
+        }
+
+        ~Computed() override
+        {
+            m_Subject.DetachObserver(this, m_Tags);
+        }
+
+        Computed(const Computed&) = delete;
+        Computed& operator=(const Computed&) = delete;
+
+        bool OnNotification(const SubjectT&, const Tag) override
+        {
+            m_IsDirty = true;
+            return true;
+        }
+
+        const Value& Get() const
+        {
+            if(m_IsDirty)
+            {
+                m_Value.emplace(std::invoke(m_Compute, std::as_const(m_Subject)));
+                m_IsDirty = false;
+            }
+
+            return *m_Value;
+        }
+
+        bool IsDirty() const { return m_IsDirty; }
+    private:
+        SubjectT& m_Subject;
+        mutable ComputeT m_Compute;
+        mutable std::optional<Value> m_Value{};
+        TagSet m_Tags{};
+        mutable bool m_IsDirty{true};
+    };
+
+    TEST_CASE("Observer - Reference Semantics - Computed Unit Tests")
+    {
+        SECTION("Lazy Recompute")
+        {
+            VectorSubjectSystem subject{};
+            uint32_t computeCount{0};
+            const Computed sum{subject, {SubjectSystemTag::ValueA, SubjectSystemTag::ValueB},
+                [&computeCount](const VectorSubjectSystem& subject)
+                {
+                    ++computeCount;
+                    return subject.GetValueA() + subject.GetValueB();
+                }};
+
+            REQUIRE(sum.IsDirty());
+            REQUIRE(computeCount == 0);
+            REQUIRE(sum.Get() == 0);
+            REQUIRE(computeCount == 1);
+
+            subject.SetValueA(1);
+            subject.SetValueA(2);
+            subject.SetValueB(3);
+
+            REQUIRE(sum.IsDirty());
+            REQUIRE(computeCount == 1);
+            REQUIRE(sum.Get() == 5);
+            REQUIRE(sum.Get() == 5);
+            REQUIRE(computeCount == 2);
+        }
+
+        SECTION("Subscribed Tags")
+        {
+            VectorSubjectSystem subject{};
+            const Computed doubledA{subject, SubjectSystemTag::ValueA,
+                [](const VectorSubjectSystem& subject)
+                {
+                    return subject.GetValueA() * 2;
+                }};
+
+            REQUIRE(doubledA.Get() == 0);
+
+            subject.SetValueB(1);
+
+            REQUIRE_FALSE(doubledA.IsDirty());
+
+            subject.SetValueA(4);
+
+            REQUIRE(doubledA.Get() == 8);
+        }
+
+        SECTION("Detach On Destruction")
+        {
+            VectorSubjectSystem subject{};
+            BasicSubjectObserverA<VectorSubjectSystem> observerA{};
+            subject.AttachObserver(&observerA);
+            {
+                const Computed valueA{subject, SubjectSystemTag::ValueA,
+                    [](const VectorSubjectSystem& subject)
+                    {
+                        return subject.GetValueA();
+                    }};
+            }
+
+            subject.SetValueA(1);
+
+            REQUIRE(observerA.GetValue() == 1);
+        }
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Computed Benchmarks")
+    {
+        // Stands in for a derived value that is expensive relative to a notification.
+        static constexpr auto compute{
+            [](const VectorSubjectSystem& subject)
+            {
+                uint64_t hash{static_cast<uint64_t>(subject.GetValueA())};
+                for(uint32_t i{0}; i != 1'000; ++i)
+                {
+                    hash = hash * 6364136223846793005ull + 1442695040888963407ull;
+                }
+
+                return hash;
+            }};
+
+        class EagerObserver final : public VectorSubjectSystem::Observer
+        {
+        public:
+            bool OnNotification(const VectorSubjectSystem& subject, const SubjectSystemTag) override
+            {
+                m_Value = compute(subject);
+                return true;
+            }
+
+            uint64_t GetValue() const { return m_Value; }
+        private:
+            uint64_t m_Value{0};
+        };
+
+        VectorSubjectSystem eagerSubject{};
+        EagerObserver eagerObserver{};
+        eagerSubject.AttachObserver(&eagerObserver, SubjectSystemTag::ValueA);
+
+        BENCHMARK("Benchmark 100x SetValueA + Read - Eager Observer")
+        {
+            for(int32_t i{0}; i != 100; ++i)
+            {
+                eagerSubject.SetValueA(i);
+            }
+
+            return eagerObserver.GetValue();
+        };
+
+        VectorSubjectSystem computedSubject{};
+        const Computed computed{computedSubject, SubjectSystemTag::ValueA, compute};
+
+        BENCHMARK("Benchmark 100x SetValueA + Read - Computed")
+        {
+            for(int32_t i{0}; i != 100; ++i)
+            {
+                computedSubject.SetValueA(i);
+            }
+
+            return computed.Get();
+        };
+    }
+}
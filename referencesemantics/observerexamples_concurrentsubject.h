@@ -0,0 +1,371 @@
+#pragma once
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <array>
+#include <vector>
+#include <algorithm>
+
+#include "observerexamples_referencesemantics.h"
+
+namespace ReferenceSemantics
+{
+    // SendNotification reads an immutable per-tag observer list through an atomic pointer without taking a lock.
+    // Attach/Detach copy the list, publish the copy and free the old one after a grace period: readers register in one
+    // of two epoch parities, the writer flips the parity twice and waits for each to drain. Reader counters are
+    // sharded per thread to keep notifying threads off each other's cache lines.
+    // Writers are serialized by a mutex. Attach/Detach from inside OnNotification publish immediately and leave the
+    // old lists to be freed by the next writer outside a notification. Observers must tolerate concurrent calls when
+    // several threads notify.
+    template<typename SubjectT, IsTagEnum TagT, size_t ShardCountT = 16>
+    class ConcurrentSubject
+    {
+    public:
+        using Observer = Observer<SubjectT, TagT>;
+        using Tag = TagT;
+        using TagSet = TagSet<TagT>;
+
+        ConcurrentSubject() = default;
+
+        ~ConcurrentSubject()
+        {
+            delete m_Observers.load();
+            for(const ObserverList* const retired : m_Retired)
+            {
+                delete retired;
+            }
+        }
+
+        ConcurrentSubject(const ConcurrentSubject&) = delete;
+        ConcurrentSubject& operator=(const ConcurrentSubject&) = delete;
+
+        void AttachObserver(Observer* const observer, const TagSet tags = TagSet::All())
+        {
+            Publish(
+                [observer, tags](ObserverList& observers)
+                {
+                    tags.ForEach(
+                        [&observers, observer](const Tag tag)
+                        {
+                            std::vector<Observer*>& tagObservers{observers[static_cast<size_t>(tag)]};
+                            if(std::find(tagObservers.begin(), tagObservers.end(), observer) == tagObservers.end())
+                            {
+                                tagObservers.push_back(observer);
+                            }
+                        });
+                });
+        }
+
+        void DetachObserver(Observer* const observer, const TagSet tags = TagSet::All())
+        {
+            Publish(
+                [observer, tags](ObserverList& observers)
+                {
+                    tags.ForEach(
+                        [&observers, observer](const Tag tag)
+                        {
+                            std::erase(observers[static_cast<size_t>(tag)], observer);
+                        });
+                });
+        }
+    protected:
+        void SendNotification(const Tag tag)
+        {
+            const ReadScope scope{*this};
+            if(const ObserverList* const observers{m_Observers.load()})
+            {
+                for(Observer* const observer : (*observers)[static_cast<size_t>(tag)])
+                {
+                    observer->OnNotification(static_cast<const SubjectT&>(*this), tag);
+                }
+            }
+        }
+    private:
+        using ObserverList = std::array<std::vector<Observer*>, TagCount<TagT>>;
+
+        struct alignas(CacheLineSize) ReaderShard
+        {
+            std::array<std::atomic<uint32_t>, 2> m_Counts{};
+        };
+
+        class ReadScope
+        {
+        public:
+            explicit ReadScope(ConcurrentSubject& subject)
+                : m_Count{subject.m_Shards[t_ShardIndex].m_Counts[subject.m_Epoch.load() & 1]}
+            {
+                m_Count.fetch_add(1);
+                ++t_ReadDepth;
+            }
+
+            ~ReadScope()
+            {
+                --t_ReadDepth;
+                m_Count.fetch_sub(1, std::memory_order_release);
+            }
+
+            ReadScope(const ReadScope&) = delete;
+            ReadScope& operator=(const ReadScope&) = delete;
+        private:
+            std::atomic<uint32_t>& m_Count;
+        };
+
+        template<typename MutateT>
+        void Publish(MutateT&& mutate)
+        {
+            std::vector<const ObserverList*> retired{};
+            {
+                const std::scoped_lock lock{m_WriterMutex};
+                const ObserverList* const current{m_Observers.load()};
+                std::unique_ptr<ObserverList> next{current != nullptr ? std::make_unique<ObserverList>(*current)
+                    : std::make_unique<ObserverList>()};
+                mutate(*next);
+                m_Observers.store(next.release());
+
+                if(current != nullptr)
+                {
+                    m_Retired.push_back(current);
+                }
+
+                // Waiting from inside a notification would wait on this thread's own read.
+                if(t_ReadDepth != 0)
+                {
+                    return;
+                }
+
+                retired.swap(m_Retired);
+            }
+
+            // The grace period runs outside the writer mutex so a notification that attaches can still publish.
+            {
+                const std::scoped_lock lock{m_GracePeriodMutex};
+                WaitForReaders();
+            }
+
+            for(const ObserverList* const observers : retired)
+            {
+                delete observers;
+            }
+        }
+
+        // Two flips cover a reader that loaded the epoch before the first flip but registered after it was drained.
+        void WaitForReaders()
+        {
+            for(uint32_t phase{0}; phase != 2; ++phase)
+            {
+                const uint64_t parity{m_Epoch.fetch_add(1) & 1};
+                for(const ReaderShard& shard : m_Shards)
+                {
+                    while(shard.m_Counts[parity].load(std::memory_order_acquire) != 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        }
+
+        static inline std::atomic<uint32_t> s_NextShardIndex{0};
+        static inline thread_local const uint32_t t_ShardIndex{
+            static_cast<uint32_t>(s_NextShardIndex.fetch_add(1) % ShardCountT)};
+        static inline thread_local uint32_t t_ReadDepth{0};
+
+        std::atomic<const ObserverList*> m_Observers{nullptr};
+        std::atomic<uint64_t> m_Epoch{0};
+        std::array<ReaderShard, ShardCountT> m_Shards{};
+        std::vector<const ObserverList*> m_Retired{};
+        std::mutex m_WriterMutex{};
+        std::mutex m_GracePeriodMutex{};
+    };
+
+    class ConcurrentSubjectSystem final : public ConcurrentSubject<ConcurrentSubjectSystem, SubjectSystemTag>
+    {
+    public:
+        void SetValueA(const int32_t value)
+        {
+            m_ValueA.store(value);
+            SendNotification(SubjectSystemTag::ValueA);
+        }
+
+        void SetValueB(const int32_t value)
+        {
+            m_ValueB.store(value);
+            SendNotification(SubjectSystemTag::ValueB);
+        }
+
+        int32_t GetValueA() const { return m_ValueA.load(); }
+        int32_t GetValueB() const { return m_ValueB.load(); }
+    private:
+        std::atomic<int32_t> m_ValueA{0};
+        std::atomic<int32_t> m_ValueB{0};
+    };
+
+    class ConcurrentSubjectObserverA final : public ConcurrentSubjectSystem::Observer
+    {
+    public:
+        bool OnNotification(const ConcurrentSubjectSystem& subject, const SubjectSystemTag tag) override
+        {
+            if(tag == SubjectSystemTag::ValueA)
+            {
+                m_Value.store(subject.GetValueA());
+                m_NotificationCount.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+
+            return false;
+        }
+
+        int32_t GetValue() const { return m_Value.load(); }
+        uint32_t GetNotificationCount() const { return m_NotificationCount.load(); }
+    private:
+        std::atomic<int32_t> m_Value{0};
+        std::atomic<uint32_t> m_NotificationCount{0};
+    };
+
+    TEST_CASE("Observer - Reference Semantics - Concurrent Subject Unit Tests")
+    {
+        SECTION("Attach/Detach")
+        {
+            ConcurrentSubjectSystem subject{};
+            ConcurrentSubjectObserverA observerA{};
+            subject.SetValueA(1);
+
+            REQUIRE(observerA.GetValue() == 0);
+
+            subject.AttachObserver(&observerA);
+            subject.AttachObserver(&observerA, SubjectSystemTag::ValueA);
+            subject.SetValueA(2);
+
+            REQUIRE(observerA.GetValue() == 2);
+            REQUIRE(observerA.GetNotificationCount() == 1);
+
+            subject.DetachObserver(&observerA, SubjectSystemTag::ValueB);
+            subject.SetValueA(3);
+
+            REQUIRE(observerA.GetValue() == 3);
+
+            subject.DetachObserver(&observerA);
+            subject.SetValueA(4);
+
+            REQUIRE(observerA.GetValue() == 3);
+            REQUIRE(observerA.GetNotificationCount() == 2);
+        }
+
+        SECTION("Attach/Detach During Notification")
+        {
+            class DetachingObserver final : public ConcurrentSubjectSystem::Observer
+            {
+            public:
+                DetachingObserver(ConcurrentSubjectSystem& subject, ConcurrentSubjectObserverA& attach)
+                    : m_Subject{subject}
+                    , m_Attach{attach}
+                {
+                }
+
+                bool OnNotification(const ConcurrentSubjectSystem&, const SubjectSystemTag) override
+                {
+                    m_Subject.DetachObserver(this);
+                    m_Subject.AttachObserver(&m_Attach);
+                    return true;
+                }
+            private:
+                ConcurrentSubjectSystem& m_Subject;
+                ConcurrentSubjectObserverA& m_Attach;
+            };
+
+            ConcurrentSubjectSystem subject{};
+            ConcurrentSubjectObserverA observerA{};
+            DetachingObserver detaching{subject, observerA};
+            subject.AttachObserver(&detaching);
+            subject.SetValueA(1);
+
+            REQUIRE(observerA.GetNotificationCount() == 0);
+
+            subject.SetValueA(2);
+
+            REQUIRE(observerA.GetValue() == 2);
+            REQUIRE(observerA.GetNotificationCount() == 1);
+        }
+
+        SECTION("Concurrent Attach/Detach/Notify")
+        {
+            constexpr uint32_t notifierCount{3};
+            constexpr int32_t notificationCount{2'000};
+            ConcurrentSubjectSystem subject{};
+            ConcurrentSubjectObserverA stableObserver{};
+            std::array<ConcurrentSubjectObserverA, 8> churnObservers{};
+            subject.AttachObserver(&stableObserver);
+
+            std::atomic<bool> isNotifying{true};
+            std::jthread writer{
+                [&subject, &churnObservers, &isNotifying]
+                {
+                    for(size_t i{0}; isNotifying.load(); ++i)
+                    {
+                        ConcurrentSubjectObserverA& observer{churnObservers[i % churnObservers.size()]};
+                        subject.AttachObserver(&observer);
+                        subject.DetachObserver(&observer);
+                    }
+                }};
+
+            {
+                std::vector<std::jthread> notifiers{};
+                for(uint32_t i{0}; i != notifierCount; ++i)
+                {
+                    notifiers.emplace_back(
+                        [&subject]
+                        {
+                            for(int32_t value{1}; value <= notificationCount; ++value)
+                            {
+                                subject.SetValueA(value);
+                            }
+                        });
+                }
+            }
+
+            isNotifying.store(false);
+            writer.join();
+
+            REQUIRE(stableObserver.GetNotificationCount() == notifierCount * notificationCount);
+        }
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Concurrent Subject Benchmarks")
+    {
+        // Every attach copies the observer list, keep the count low enough to build it one attach at a time.
+        constexpr uint32_t creationCount{10'000};
+        VectorSubjectSystem vectorSubject{};
+        std::vector<std::unique_ptr<BasicSubjectObserverA<VectorSubjectSystem>>> vectorObservers{};
+        ConcurrentSubjectSystem concurrentSubject{};
+        std::vector<std::unique_ptr<ConcurrentSubjectObserverA>> concurrentObservers{};
+        for(uint32_t i{0}; i != creationCount; ++i)
+        {
+            vectorObservers.push_back(std::make_unique<BasicSubjectObserverA<VectorSubjectSystem>>());
+            vectorSubject.AttachObserver(vectorObservers.back().get());
+            concurrentObservers.push_back(std::make_unique<ConcurrentSubjectObserverA>());
+            concurrentSubject.AttachObserver(concurrentObservers.back().get());
+        }
+
+        std::mutex vectorSubjectMutex{};
+        BENCHMARK("Benchmark Notification - Vector Storage - Mutex")
+        {
+            const std::scoped_lock lock{vectorSubjectMutex};
+            vectorSubject.SetValueA(0);
+        };
+
+        BENCHMARK("Benchmark Notification - Concurrent Subject")
+        {
+            concurrentSubject.SetValueA(0);
+        };
+
+        BENCHMARK("Benchmark Attach/Detach - Concurrent Subject")
+        {
+            concurrentSubject.DetachObserver(concurrentObservers.front().get());
+            concurrentSubject.AttachObserver(concurrentObservers.front().get());
+        };
+    }
+}
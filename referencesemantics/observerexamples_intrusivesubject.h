@@ -0,0 +1,593 @@
+#pragma once
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "observerexamples_referencesemantics.h"
+
+namespace ReferenceSemantics
+{
+    template<typename SubjectT, IsTagEnum TagT>
+    class IntrusiveSubject;
+
+    // Observer embedding one list hook per tag, attach and detach splice the hook in O(1) without allocating.
+    // A hook records the subject it is linked into and can only be linked into one subject at a time.
+    // Destroying the observer detaches it from every tag.
+    template<typename SubjectT, IsTagEnum TagT>
+    class IntrusiveObserver
+    {
+    public:
+        IntrusiveObserver() = default;
+
+        virtual ~IntrusiveObserver()
+        {
+            for(Hook& hook : m_Hooks)
+            {
+                hook.Unlink();
+            }
+        }
+
+        IntrusiveObserver(const IntrusiveObserver&) = delete;
+        IntrusiveObserver& operator=(const IntrusiveObserver&) = delete;
+
+        virtual bool OnNotification(const SubjectT& subject, const TagT tag) = 0;
+
+        bool IsAttached(const TagT tag) const { return m_Hooks[static_cast<size_t>(tag)].IsLinked(); }
+    private:
+        friend class IntrusiveSubject<SubjectT, TagT>;
+
+        struct Hook
+        {
+            bool IsLinked() const { return m_Next != nullptr; }
+
+            void Unlink()
+            {
+                if(IsLinked())
+                {
+                    m_Owner->SkipInNotifications(this);
+                    m_Prev->m_Next = m_Next;
+                    m_Next->m_Prev = m_Prev;
+                    m_Next = nullptr;
+                    m_Prev = nullptr;
+                    m_Owner = nullptr;
+                }
+            }
+
+            Hook* m_Next{nullptr};
+            Hook* m_Prev{nullptr};
+            IntrusiveObserver* m_Observer{nullptr};
+            const IntrusiveSubject<SubjectT, TagT>* m_Owner{nullptr};
+        };
+
+        std::array<Hook, TagCount<TagT>> m_Hooks{};
+    };
+
+    // Keeps a circular list per tag threaded through the observers' hooks, so the subject owns no observer memory.
+    // Like Subject, observers attached during a notification first receive the next one, they are appended behind an
+    // end marker linked for the notification's duration. Observers may detach or destroy themselves or other observers
+    // from inside OnNotification, the notifications in progress skip their hooks.
+    template<typename SubjectT, IsTagEnum TagT>
+    class IntrusiveSubject
+    {
+    public:
+        using Observer = IntrusiveObserver<SubjectT, TagT>;
+        using Tag = TagT;
+        using TagSet = TagSet<TagT>;
+
+        IntrusiveSubject()
+        {
+            for(Hook& head : m_Heads)
+            {
+                head.m_Next = &head;
+                head.m_Prev = &head;
+            }
+        }
+
+        // Observers outliving the subject are left unlinked.
+        ~IntrusiveSubject()
+        {
+            for(Hook& head : m_Heads)
+            {
+                while(head.m_Next != &head)
+                {
+                    head.m_Next->Unlink();
+                }
+            }
+        }
+
+        IntrusiveSubject(const IntrusiveSubject&) = delete;
+        IntrusiveSubject& operator=(const IntrusiveSubject&) = delete;
+
+        // Tags already attached to this subject are kept. Returns false if a tag is attached to another subject, that
+        // tag is left attached to the other subject.
+        bool AttachObserver(Observer* const observer, const TagSet tags = TagSet::All())
+        {
+            bool isAttached{true};
+            tags.ForEach(
+                [this, observer, &isAttached](const Tag tag)
+                {
+                    Hook& hook{observer->m_Hooks[static_cast<size_t>(tag)]};
+                    if(hook.IsLinked())
+                    {
+                        isAttached = isAttached && hook.m_Owner == this;
+                        return;
+                    }
+
+                    hook.m_Observer = observer;
+                    LinkAtTail(tag, hook);
+                });
+
+            return isAttached;
+        }
+
+        // Only unlinks tags attached to this subject. Returns false if a tag is attached to another subject, that tag
+        // is left attached to the other subject.
+        bool DetachObserver(Observer* const observer, const TagSet tags = TagSet::All())
+        {
+            bool isDetached{true};
+            tags.ForEach(
+                [this, observer, &isDetached](const Tag tag)
+                {
+                    Hook& hook{observer->m_Hooks[static_cast<size_t>(tag)]};
+                    if(hook.IsLinked() && hook.m_Owner != this)
+                    {
+                        isDetached = false;
+                        return;
+                    }
+
+                    hook.Unlink();
+                });
+
+            return isDetached;
+        }
+    protected:
+        void SendNotification(const Tag tag)
+        {
+            Notification notification{};
+            notification.m_Outer = m_Notifications;
+            m_Notifications = &notification;
+            Hook& end{notification.m_End};
+            LinkAtTail(tag, end);
+            notification.m_Next = m_Heads[static_cast<size_t>(tag)].m_Next;
+            while(notification.m_Next != &end)
+            {
+                // Advance before the call, unlinking the next hook moves m_Next past it.
+                Hook* const hook{notification.m_Next};
+                notification.m_Next = hook->m_Next;
+                if(hook->m_Observer != nullptr)
+                {
+                    hook->m_Observer->OnNotification(static_cast<const SubjectT&>(*this), tag);
+                }
+            }
+
+            end.Unlink();
+            m_Notifications = notification.m_Outer;
+        }
+    private:
+        friend Observer;
+
+        using Hook = typename Observer::Hook;
+
+        // A notification in progress, the end marker has no observer and is skipped by nested notifications.
+        struct Notification
+        {
+            Hook m_End{};
+            Hook* m_Next{nullptr};
+            Notification* m_Outer{nullptr};
+        };
+
+        void LinkAtTail(const Tag tag, Hook& hook)
+        {
+            Hook& head{m_Heads[static_cast<size_t>(tag)]};
+            hook.m_Owner = this;
+            hook.m_Next = &head;
+            hook.m_Prev = head.m_Prev;
+            head.m_Prev->m_Next = &hook;
+            head.m_Prev = &hook;
+        }
+
+        void SkipInNotifications(const Hook* const hook) const
+        {
+            for(Notification* notification{m_Notifications}; notification != nullptr; notification = notification->m_Outer)
+            {
+                if(notification->m_Next == hook)
+                {
+                    notification->m_Next = hook->m_Next;
+                }
+            }
+        }
+
+        std::array<Hook, TagCount<TagT>> m_Heads{};
+        Notification* m_Notifications{nullptr};
+    };
+
+    class IntrusiveSubjectSystem final : public IntrusiveSubject<IntrusiveSubjectSystem, SubjectSystemTag>
+    {
+    public:
+        void SetValueA(const int32_t value)
+        {
+            m_ValueA = value;
+            SendNotification(SubjectSystemTag::ValueA);
+        }
+
+        void SetValueB(const int32_t value)
+        {
+            m_ValueB = value;
+            SendNotification(SubjectSystemTag::ValueB);
+        }
+
+        int32_t GetValueA() const { return m_ValueA; }
+        int32_t GetValueB() const { return m_ValueB; }
+    private:
+        int32_t m_ValueA{0};
+        int32_t m_ValueB{0};
+    };
+
+    class IntrusiveSubjectObserverA final : public IntrusiveSubjectSystem::Observer
+    {
+    public:
+        bool OnNotification(const IntrusiveSubjectSystem& subject, const SubjectSystemTag tag) override
+        {
+            if(tag == SubjectSystemTag::ValueA)
+            {
+                m_Value = subject.GetValueA();
+                return true;
+            }
+
+            return false;
+        }
+
+        int32_t GetValue() const { return m_Value; }
+    private:
+        int32_t m_Value{0};
+    };
+
+    class IntrusiveSubjectObserverB final : public IntrusiveSubjectSystem::Observer
+    {
+    public:
+        bool OnNotification(const IntrusiveSubjectSystem& subject, const SubjectSystemTag tag) override
+        {
+            if(tag == SubjectSystemTag::ValueB)
+            {
+                m_Value = subject.GetValueB();
+                return true;
+            }
+
+            return false;
+        }
+
+        int32_t GetValue() const { return m_Value; }
+    private:
+        int32_t m_Value{0};
+    };
+
+    TEST_CASE("Observer - Reference Semantics - Intrusive Subject Unit Tests")
+    {
+        SECTION("Attach/Detach")
+        {
+            IntrusiveSubjectSystem subject{};
+            IntrusiveSubjectObserverA observerA{};
+            IntrusiveSubjectObserverB observerB{};
+            subject.AttachObserver(&observerA);
+            subject.AttachObserver(&observerA);
+            subject.AttachObserver(&observerB, SubjectSystemTag::ValueB);
+
+            REQUIRE(observerA.IsAttached(SubjectSystemTag::ValueA));
+            REQUIRE(observerA.IsAttached(SubjectSystemTag::ValueB));
+            REQUIRE_FALSE(observerB.IsAttached(SubjectSystemTag::ValueA));
+
+            subject.SetValueA(1);
+            subject.SetValueB(2);
+
+            REQUIRE(observerA.GetValue() == 1);
+            REQUIRE(observerB.GetValue() == 2);
+
+            subject.DetachObserver(&observerA, SubjectSystemTag::ValueA);
+            subject.SetValueA(3);
+
+            REQUIRE(observerA.GetValue() == 1);
+            REQUIRE(observerA.IsAttached(SubjectSystemTag::ValueB));
+
+            subject.DetachObserver(&observerA);
+
+            REQUIRE_FALSE(observerA.IsAttached(SubjectSystemTag::ValueB));
+        }
+
+        SECTION("Other Subject")
+        {
+            IntrusiveSubjectSystem subject{};
+            IntrusiveSubjectSystem otherSubject{};
+            IntrusiveSubjectObserverA observerA{};
+            IntrusiveSubjectObserverA otherObserverA{};
+            REQUIRE(otherSubject.AttachObserver(&otherObserverA));
+            REQUIRE(subject.AttachObserver(&observerA));
+
+            REQUIRE_FALSE(otherSubject.AttachObserver(&observerA));
+            REQUIRE_FALSE(otherSubject.DetachObserver(&observerA));
+            REQUIRE(observerA.IsAttached(SubjectSystemTag::ValueA));
+
+            subject.SetValueA(1);
+            otherSubject.SetValueA(2);
+
+            REQUIRE(observerA.GetValue() == 1);
+            REQUIRE(otherObserverA.GetValue() == 2);
+
+            REQUIRE(subject.DetachObserver(&observerA, SubjectSystemTag::ValueA));
+            REQUIRE(otherSubject.AttachObserver(&observerA, SubjectSystemTag::ValueA));
+
+            otherSubject.SetValueA(3);
+
+            REQUIRE(observerA.GetValue() == 3);
+            REQUIRE(otherObserverA.GetValue() == 3);
+        }
+
+        SECTION("Observer Destroyed")
+        {
+            IntrusiveSubjectSystem subject{};
+            IntrusiveSubjectObserverA observerA{};
+            {
+                IntrusiveSubjectObserverA destroyed{};
+                subject.AttachObserver(&destroyed);
+                subject.AttachObserver(&observerA);
+            }
+
+            subject.SetValueA(1);
+
+            REQUIRE(observerA.GetValue() == 1);
+        }
+
+        SECTION("Subject Destroyed")
+        {
+            IntrusiveSubjectObserverA observerA{};
+            {
+                IntrusiveSubjectSystem subject{};
+                subject.AttachObserver(&observerA);
+            }
+
+            REQUIRE_FALSE(observerA.IsAttached(SubjectSystemTag::ValueA));
+
+            IntrusiveSubjectSystem subject{};
+            subject.AttachObserver(&observerA);
+            subject.SetValueA(1);
+
+            REQUIRE(observerA.GetValue() == 1);
+        }
+
+        SECTION("Detach During Notification")
+        {
+            class OneShotObserver final : public IntrusiveSubjectSystem::Observer
+            {
+            public:
+                explicit OneShotObserver(IntrusiveSubjectSystem& subject)
+                    : m_Subject{subject}
+                {
+                }
+
+                bool OnNotification(const IntrusiveSubjectSystem&, const SubjectSystemTag tag) override
+                {
+                    ++m_Count;
+                    m_Subject.DetachObserver(this, tag);
+                    return true;
+                }
+
+                uint32_t GetCount() const { return m_Count; }
+            private:
+                IntrusiveSubjectSystem& m_Subject;
+                uint32_t m_Count{0};
+            };
+
+            IntrusiveSubjectSystem subject{};
+            OneShotObserver oneShot{subject};
+            IntrusiveSubjectObserverA observerA{};
+            subject.AttachObserver(&oneShot);
+            subject.AttachObserver(&observerA);
+            subject.SetValueA(1);
+            subject.SetValueA(2);
+
+            REQUIRE(oneShot.GetCount() == 1);
+            REQUIRE(observerA.GetValue() == 2);
+        }
+
+        SECTION("Attach During Notification")
+        {
+            class AttachingObserver final : public IntrusiveSubjectSystem::Observer
+            {
+            public:
+                AttachingObserver(IntrusiveSubjectSystem& subject, IntrusiveSubjectSystem::Observer& attached)
+                    : m_Subject{subject}
+                    , m_Attached{attached}
+                {
+                }
+
+                bool OnNotification(const IntrusiveSubjectSystem&, const SubjectSystemTag tag) override
+                {
+                    m_Subject.AttachObserver(&m_Attached, tag);
+                    return true;
+                }
+            private:
+                IntrusiveSubjectSystem& m_Subject;
+                IntrusiveSubjectSystem::Observer& m_Attached;
+            };
+
+            // The attaching observer is last in the list, the appended observer first receives the next notification.
+            IntrusiveSubjectSystem subject{};
+            IntrusiveSubjectObserverA observerA{};
+            IntrusiveSubjectObserverA attachedA{};
+            AttachingObserver attaching{subject, attachedA};
+            subject.AttachObserver(&observerA);
+            subject.AttachObserver(&attaching, SubjectSystemTag::ValueA);
+            subject.SetValueA(1);
+
+            REQUIRE(observerA.GetValue() == 1);
+            REQUIRE(attachedA.IsAttached(SubjectSystemTag::ValueA));
+            REQUIRE(attachedA.GetValue() == 0);
+
+            subject.SetValueA(2);
+
+            REQUIRE(attachedA.GetValue() == 2);
+        }
+
+        SECTION("Re-Attach Self During Notification")
+        {
+            class ReattachingObserver final : public IntrusiveSubjectSystem::Observer
+            {
+            public:
+                explicit ReattachingObserver(IntrusiveSubjectSystem& subject)
+                    : m_Subject{subject}
+                {
+                }
+
+                bool OnNotification(const IntrusiveSubjectSystem&, const SubjectSystemTag tag) override
+                {
+                    ++m_Count;
+                    m_Subject.DetachObserver(this, tag);
+                    m_Subject.AttachObserver(this, tag);
+                    return true;
+                }
+
+                uint32_t GetCount() const { return m_Count; }
+            private:
+                IntrusiveSubjectSystem& m_Subject;
+                uint32_t m_Count{0};
+            };
+
+            // Re-attaching appends behind the end marker, the notification finishes instead of revisiting the observer.
+            IntrusiveSubjectSystem subject{};
+            ReattachingObserver reattaching{subject};
+            IntrusiveSubjectObserverA observerA{};
+            subject.AttachObserver(&reattaching, SubjectSystemTag::ValueA);
+            subject.AttachObserver(&observerA);
+            subject.SetValueA(1);
+
+            REQUIRE(reattaching.GetCount() == 1);
+            REQUIRE(observerA.GetValue() == 1);
+
+            subject.SetValueA(2);
+
+            REQUIRE(reattaching.GetCount() == 2);
+            REQUIRE(reattaching.IsAttached(SubjectSystemTag::ValueA));
+        }
+
+        SECTION("Detach Neighbour During Notification")
+        {
+            class DetachingObserver final : public IntrusiveSubjectSystem::Observer
+            {
+            public:
+                DetachingObserver(IntrusiveSubjectSystem& subject, IntrusiveSubjectSystem::Observer& detached)
+                    : m_Subject{subject}
+                    , m_Detached{detached}
+                {
+                }
+
+                bool OnNotification(const IntrusiveSubjectSystem&, const SubjectSystemTag tag) override
+                {
+                    m_Subject.DetachObserver(&m_Detached, tag);
+                    return true;
+                }
+            private:
+                IntrusiveSubjectSystem& m_Subject;
+                IntrusiveSubjectSystem::Observer& m_Detached;
+            };
+
+            IntrusiveSubjectSystem subject{};
+            IntrusiveSubjectObserverA previousA{};
+            IntrusiveSubjectObserverA nextA{};
+            IntrusiveSubjectObserverA lastA{};
+            DetachingObserver detachingPrevious{subject, previousA};
+            DetachingObserver detachingNext{subject, nextA};
+            subject.AttachObserver(&previousA);
+            subject.AttachObserver(&detachingPrevious, SubjectSystemTag::ValueA);
+            subject.AttachObserver(&detachingNext, SubjectSystemTag::ValueA);
+            subject.AttachObserver(&nextA);
+            subject.AttachObserver(&lastA);
+            subject.SetValueA(1);
+
+            // The preceding observer was already notified, the following one is skipped by the notification in flight.
+            REQUIRE(previousA.GetValue() == 1);
+            REQUIRE_FALSE(previousA.IsAttached(SubjectSystemTag::ValueA));
+            REQUIRE(nextA.GetValue() == 0);
+            REQUIRE_FALSE(nextA.IsAttached(SubjectSystemTag::ValueA));
+            REQUIRE(lastA.GetValue() == 1);
+        }
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Intrusive Subject Benchmarks")
+    {
+        constexpr uint32_t creationCount{250'000};
+        SubjectSystem subject{};
+        std::vector<std::unique_ptr<SubjectObserverA>> observers{};
+        IntrusiveSubjectSystem intrusiveSubject{};
+        std::vector<std::unique_ptr<IntrusiveSubjectObserverA>> intrusiveObservers{};
+        observers.reserve(creationCount);
+        intrusiveObservers.reserve(creationCount);
+        for(uint32_t i{0}; i != creationCount; ++i)
+        {
+            observers.push_back(std::make_unique<SubjectObserverA>());
+            intrusiveObservers.push_back(std::make_unique<IntrusiveSubjectObserverA>());
+        }
+
+        BENCHMARK("Benchmark Attach + Detach")
+        {
+            for(std::unique_ptr<SubjectObserverA>& observer : observers)
+            {
+                subject.AttachObserver(observer.get());
+            }
+
+            for(std::unique_ptr<SubjectObserverA>& observer : observers)
+            {
+                subject.DetachObserver(observer.get());
+            }
+        };
+
+        BENCHMARK("Benchmark Attach + Detach - Intrusive")
+        {
+            for(std::unique_ptr<IntrusiveSubjectObserverA>& observer : intrusiveObservers)
+            {
+                intrusiveSubject.AttachObserver(observer.get());
+            }
+
+            for(std::unique_ptr<IntrusiveSubjectObserverA>& observer : intrusiveObservers)
+            {
+                intrusiveSubject.DetachObserver(observer.get());
+            }
+        };
+
+        for(uint32_t i{0}; i != creationCount; ++i)
+        {
+            subject.AttachObserver(observers[i].get());
+            intrusiveSubject.AttachObserver(intrusiveObservers[i].get());
+        }
+
+        BENCHMARK("Benchmark Churn 10%")
+        {
+            for(uint32_t i{0}; i < creationCount; i += 10)
+            {
+                subject.DetachObserver(observers[i].get());
+                subject.AttachObserver(observers[i].get());
+            }
+        };
+
+        BENCHMARK("Benchmark Churn 10% - Intrusive")
+        {
+            for(uint32_t i{0}; i < creationCount; i += 10)
+            {
+                intrusiveSubject.DetachObserver(intrusiveObservers[i].get());
+                intrusiveSubject.AttachObserver(intrusiveObservers[i].get());
+            }
+        };
+
+        BENCHMARK("Benchmark Notification")
+        {
+            subject.SetValueA(0);
+        };
+
+        BENCHMARK("Benchmark Notification - Intrusive")
+        {
+            intrusiveSubject.SetValueA(0);
+        };
+    }
+}
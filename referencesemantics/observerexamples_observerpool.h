@@ -0,0 +1,200 @@
+#pragma once
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <memory>
+#include <vector>
+#include <unordered_set>
+#include <cstddef>
+#include <stdexcept>
+
+namespace ReferenceSemantics
+{
+    // Allocates objects contiguously in chunks of ChunkSizeT, so observers created together are notified from
+    // neighbouring cache lines. Pointers stay valid until Destroy or the pool is destroyed, destroyed slots are reused
+    // most recently freed first. Objects still alive when the pool is destroyed are destroyed with it.
+    template<typename T, size_t ChunkSizeT = 4096>
+    class ObserverPool
+    {
+    public:
+        ObserverPool() = default;
+
+        ~ObserverPool()
+        {
+            const std::unordered_set<T*> freeObjects{m_FreeObjects.begin(), m_FreeObjects.end()};
+            for(size_t chunk{0}; chunk != m_Chunks.size(); ++chunk)
+            {
+                const size_t count{chunk + 1 == m_Chunks.size() ? m_NextIndex : ChunkSizeT};
+                for(size_t i{0}; i != count; ++i)
+                {
+                    T* const object{GetObject(m_Chunks[chunk][i])};
+                    if(!freeObjects.contains(object))
+                    {
+                        std::destroy_at(object);
+                    }
+                }
+            }
+        }
+
+        ObserverPool(const ObserverPool&) = delete;
+        ObserverPool& operator=(const ObserverPool&) = delete;
+
+        // The pool is unchanged if T's constructor throws, apart from a possibly added empty chunk.
+        template<typename... ArgsT>
+        T* Create(ArgsT&&... args)
+        {
+            const bool isReused{!m_FreeObjects.empty()};
+            if(!isReused && (m_Chunks.empty() || m_NextIndex == ChunkSizeT))
+            {
+                m_Chunks.push_back(std::make_unique_for_overwrite<Slot[]>(ChunkSizeT));
+                m_NextIndex = 0;
+            }
+
+            Slot& slot{isReused ? *reinterpret_cast<Slot*>(m_FreeObjects.back()) : m_Chunks.back()[m_NextIndex]};
+            T* const object{std::construct_at(reinterpret_cast<T*>(slot.m_Storage), std::forward<ArgsT>(args)...)};
+            if(isReused)
+            {
+                m_FreeObjects.pop_back();
+            }
+            else
+            {
+                ++m_NextIndex;
+            }
+
+            ++m_Size;
+            return object;
+        }
+
+        void Destroy(T* const object)
+        {
+            std::destroy_at(object);
+            m_FreeObjects.push_back(object);
+            --m_Size;
+        }
+
+        size_t Size() const { return m_Size; }
+    private:
+        struct Slot
+        {
+            alignas(T) std::byte m_Storage[sizeof(T)];
+        };
+
+        static T* GetObject(Slot& slot) { return std::launder(reinterpret_cast<T*>(slot.m_Storage)); }
+
+        std::vector<std::unique_ptr<Slot[]>> m_Chunks{};
+        std::vector<T*> m_FreeObjects{};
+        size_t m_NextIndex{0};
+        size_t m_Size{0};
+    };
+
+    TEST_CASE("Observer - Reference Semantics - Observer Pool Unit Tests")
+    {
+        class CountedObject
+        {
+        public:
+            CountedObject(int32_t& liveCount, const int32_t value)
+                : m_LiveCount{liveCount}
+                , m_Value{value}
+            {
+                ++m_LiveCount;
+            }
+
+            ~CountedObject()
+            {
+                --m_LiveCount;
+            }
+
+            CountedObject(const CountedObject&) = delete;
+            CountedObject& operator=(const CountedObject&) = delete;
+
+            int32_t GetValue() const { return m_Value; }
+        private:
+            int32_t& m_LiveCount;
+            int32_t m_Value{0};
+        };
+
+        int32_t liveCount{0};
+        {
+            ObserverPool<CountedObject, 64> pool{};
+            std::vector<CountedObject*> objects{};
+            for(int32_t i{0}; i != 200; ++i)
+            {
+                objects.push_back(pool.Create(liveCount, i));
+            }
+
+            REQUIRE(pool.Size() == 200);
+            REQUIRE(liveCount == 200);
+            REQUIRE(reinterpret_cast<std::byte*>(objects[1]) - reinterpret_cast<std::byte*>(objects[0])
+                == sizeof(CountedObject));
+            REQUIRE(objects.front()->GetValue() == 0);
+            REQUIRE(objects.back()->GetValue() == 199);
+
+            CountedObject* const destroyed{objects[10]};
+            pool.Destroy(destroyed);
+
+            REQUIRE(pool.Size() == 199);
+            REQUIRE(liveCount == 199);
+            REQUIRE(pool.Create(liveCount, -1) == destroyed);
+            REQUIRE(liveCount == 200);
+            REQUIRE(destroyed->GetValue() == -1);
+
+            pool.Destroy(objects[20]);
+        }
+
+        REQUIRE(liveCount == 0);
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Observer Pool Throwing Constructor Unit Tests")
+    {
+        class ThrowingObject
+        {
+        public:
+            ThrowingObject(int32_t& liveCount, const bool isThrowing)
+                : m_LiveCount{liveCount}
+            {
+                if(isThrowing)
+                {
+                    throw std::runtime_error{"ThrowingObject"};
+                }
+
+                ++m_LiveCount;
+            }
+
+            ~ThrowingObject()
+            {
+                --m_LiveCount;
+            }
+        private:
+            int32_t& m_LiveCount;
+        };
+
+        int32_t liveCount{0};
+        {
+            ObserverPool<ThrowingObject, 4> pool{};
+            REQUIRE_THROWS_AS(pool.Create(liveCount, true), std::runtime_error);
+            REQUIRE(pool.Size() == 0);
+
+            ThrowingObject* const first{pool.Create(liveCount, false)};
+            ThrowingObject* const second{pool.Create(liveCount, false)};
+            pool.Destroy(first);
+
+            REQUIRE_THROWS_AS(pool.Create(liveCount, true), std::runtime_error);
+            REQUIRE(pool.Size() == 1);
+            REQUIRE(pool.Create(liveCount, false) == first);
+            REQUIRE(second != first);
+            REQUIRE(liveCount == 2);
+
+            for(uint32_t i{0}; i != 2; ++i)
+            {
+                pool.Create(liveCount, false);
+            }
+
+            REQUIRE_THROWS_AS(pool.Create(liveCount, true), std::runtime_error);
+            REQUIRE(pool.Size() == 4);
+            REQUIRE(liveCount == 4);
+        }
+
+        REQUIRE(liveCount == 0);
+    }
+}
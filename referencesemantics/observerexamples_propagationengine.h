@@ -0,0 +1,426 @@
+#pragma once
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "observerexamples_referencesemantics.h"
+
+namespace ReferenceSemantics
+{
+    // Schedules nodes of an acyclic graph of subjects observing subjects, so a change reaching a node through several
+    // paths runs it once, after every node upstream of it. Nodes are ranked one above their highest upstream node,
+    // plain subjects rank 0. Notifications reaching nodes inside a Transaction are collected and the nodes are run in
+    // rank order when the outermost Transaction exits. A notification reaching a node outside a Transaction opens one
+    // closed when the upstream subject's notification returns, so every node it reaches is scheduled before any runs.
+    // Upstream subjects must therefore provide CallAfterNotification, see Subject.
+    class PropagationEngine
+    {
+    public:
+        class Node;
+
+        class Transaction
+        {
+        public:
+            explicit Transaction(PropagationEngine& engine)
+                : m_Engine{engine}
+            {
+                m_Engine.OpenTransaction();
+            }
+
+            ~Transaction()
+            {
+                m_Engine.CloseTransaction();
+            }
+
+            Transaction(const Transaction&) = delete;
+            Transaction& operator=(const Transaction&) = delete;
+        private:
+            PropagationEngine& m_Engine;
+        };
+
+        // Base of a scheduled node, typically also a Subject its downstream nodes depend on.
+        class Node
+        {
+        public:
+            virtual ~Node() = default;
+
+            Node(const Node&) = delete;
+            Node& operator=(const Node&) = delete;
+
+            uint32_t GetRank() const { return m_Rank; }
+        protected:
+            explicit Node(PropagationEngine& engine)
+                : m_Engine{engine}
+            {
+            }
+
+            // Runs at most once per Transaction, after every upstream node. Notifies downstream if the value changed.
+            virtual void OnPropagate() = 0;
+
+            // Build the graph from the roots down, a node's rank must be final before downstream nodes depend on it.
+            // The upstream subject must outlive this node.
+            template<typename UpstreamT>
+            void DependOn(UpstreamT& upstream, const typename UpstreamT::TagSet tags = UpstreamT::TagSet::All())
+            {
+                if constexpr(std::derived_from<UpstreamT, Node>)
+                {
+                    m_Rank = std::max(m_Rank, upstream.GetRank() + 1);
+                }
+
+                m_Links.push_back(std::make_unique<Link<UpstreamT>>(*this, upstream, tags));
+            }
+        private:
+            friend class PropagationEngine;
+
+            struct LinkBase
+            {
+                virtual ~LinkBase() = default;
+            };
+
+            template<typename UpstreamT>
+            class Link final : public LinkBase, public UpstreamT::Observer
+            {
+            public:
+                Link(Node& node, UpstreamT& upstream, const typename UpstreamT::TagSet tags)
+                    : m_Node{node}
+                    , m_Upstream{upstream}
+                    , m_Tags{tags}
+                {
+                    m_Upstream.AttachObserver(this, m_Tags);
+                }
+
+                ~Link() override
+                {
+                    m_Upstream.DetachObserver(this, m_Tags);
+                }
+
+                bool OnNotification(const UpstreamT&, const typename UpstreamT::Tag) override
+                {
+                    PropagationEngine& engine{m_Node.m_Engine};
+                    if(engine.m_TransactionDepth == 0)
+                    {
+                        engine.OpenTransaction();
+                        m_Upstream.CallAfterNotification(&CloseTransaction, &engine);
+                    }
+
+                    engine.Schedule(m_Node);
+                    return true;
+                }
+            private:
+                static void CloseTransaction(void* const engine)
+                {
+                    static_cast<PropagationEngine*>(engine)->CloseTransaction();
+                }
+
+                Node& m_Node;
+                UpstreamT& m_Upstream;
+                typename UpstreamT::TagSet m_Tags{};
+            };
+
+            PropagationEngine& m_Engine;
+            std::vector<std::unique_ptr<LinkBase>> m_Links{};
+            uint32_t m_Rank{1};
+            bool m_IsScheduled{false};
+        };
+
+        PropagationEngine() = default;
+
+        PropagationEngine(const PropagationEngine&) = delete;
+        PropagationEngine& operator=(const PropagationEngine&) = delete;
+    private:
+        void OpenTransaction()
+        {
+            ++m_TransactionDepth;
+        }
+
+        void CloseTransaction()
+        {
+            if(m_TransactionDepth == 1)
+            {
+                Propagate();
+            }
+
+            --m_TransactionDepth;
+        }
+
+        void Schedule(Node& node)
+        {
+            if(node.m_IsScheduled)
+            {
+                return;
+            }
+
+            node.m_IsScheduled = true;
+            if(m_Scheduled.size() <= node.m_Rank)
+            {
+                m_Scheduled.resize(node.m_Rank + 1);
+            }
+
+            m_Scheduled[node.m_Rank].push_back(&node);
+        }
+
+        // Nodes only schedule downstream nodes, which rank higher, so each rank is complete once it is reached.
+        void Propagate()
+        {
+            for(size_t rank{0}; rank < m_Scheduled.size(); ++rank)
+            {
+                for(size_t i{0}; i < m_Scheduled[rank].size(); ++i)
+                {
+                    Node* const node{m_Scheduled[rank][i]};
+                    node->m_IsScheduled = false;
+                    node->OnPropagate();
+                }
+
+                m_Scheduled[rank].clear();
+            }
+        }
+
+        std::vector<std::vector<Node*>> m_Scheduled{};
+        uint32_t m_TransactionDepth{0};
+    };
+
+    // Example node, a value computed from its upstream subjects and notified under SubjectSystemTag::ValueA on change.
+    template<typename ComputeT>
+    class PropagationValueNode final
+        : public PropagationEngine::Node
+        , public Subject<PropagationValueNode<ComputeT>, SubjectSystemTag, VectorObserverStorage>
+    {
+    public:
+        PropagationValueNode(PropagationEngine& engine, ComputeT compute)
+            : Node{engine}
+            , m_Compute{std::move(compute)}
+            , m_Value{m_Compute()}
+        {
+        }
+
+        using Node::DependOn;
+
+        int32_t GetValueA() const { return m_Value; }
+        uint32_t GetPropagationCount() const { return m_PropagationCount; }
+    private:
+        void OnPropagate() override
+        {
+            ++m_PropagationCount;
+            const int32_t value{m_Compute()};
+            if(std::exchange(m_Value, value) != value)
+            {
+                this->SendNotification(SubjectSystemTag::ValueA);
+            }
+        }
+
+        ComputeT m_Compute;
+        int32_t m_Value{0};
+        uint32_t m_PropagationCount{0};
+    };
+
+    TEST_CASE("Observer - Reference Semantics - Propagation Engine Unit Tests")
+    {
+        // root -> left, right -> sink, sink records every (left, right) pair it observes.
+        PropagationEngine engine{};
+        VectorSubjectSystem root{};
+        PropagationValueNode left{engine,
+            [&root]
+            {
+                return root.GetValueA() * 2;
+            }};
+        left.DependOn(root);
+
+        PropagationValueNode right{engine,
+            [&root]
+            {
+                return root.GetValueA() + 1;
+            }};
+        right.DependOn(root);
+
+        std::vector<std::pair<int32_t, int32_t>> observed{};
+        PropagationValueNode sink{engine,
+            [&left, &right, &observed]
+            {
+                observed.emplace_back(left.GetValueA(), right.GetValueA());
+                return left.GetValueA() + right.GetValueA();
+            }};
+        sink.DependOn(left);
+        sink.DependOn(right);
+        observed.clear();
+
+        BasicSubjectObserverA<decltype(sink)> sinkObserver{};
+        sink.AttachObserver(&sinkObserver);
+
+        REQUIRE(left.GetRank() == 1);
+        REQUIRE(right.GetRank() == 1);
+        REQUIRE(sink.GetRank() == 2);
+
+        SECTION("Transaction")
+        {
+            {
+                const PropagationEngine::Transaction transaction{engine};
+                root.SetValueA(1);
+
+                REQUIRE(left.GetPropagationCount() == 0);
+            }
+
+            REQUIRE(left.GetPropagationCount() == 1);
+            REQUIRE(right.GetPropagationCount() == 1);
+            REQUIRE(sink.GetPropagationCount() == 1);
+            REQUIRE(observed == std::vector<std::pair<int32_t, int32_t>>{{2, 2}});
+            REQUIRE(sinkObserver.GetValue() == 4);
+
+            {
+                const PropagationEngine::Transaction transaction{engine};
+                root.SetValueA(2);
+                root.SetValueA(3);
+            }
+
+            REQUIRE(left.GetPropagationCount() == 2);
+            REQUIRE(sink.GetPropagationCount() == 2);
+            REQUIRE(observed.back() == std::pair<int32_t, int32_t>{6, 4});
+            REQUIRE(sinkObserver.GetValue() == 10);
+        }
+
+        SECTION("Unchanged Value")
+        {
+            {
+                const PropagationEngine::Transaction transaction{engine};
+                root.SetValueB(1);
+            }
+
+            REQUIRE(left.GetPropagationCount() == 1);
+            REQUIRE(sink.GetPropagationCount() == 0);
+        }
+
+        SECTION("Outside Transaction")
+        {
+            root.SetValueA(1);
+
+            REQUIRE(left.GetPropagationCount() == 1);
+            REQUIRE(right.GetPropagationCount() == 1);
+            REQUIRE(sink.GetPropagationCount() == 1);
+            REQUIRE(observed == std::vector<std::pair<int32_t, int32_t>>{{2, 2}});
+            REQUIRE(sinkObserver.GetValue() == 4);
+
+            root.SetValueA(2);
+
+            REQUIRE(sink.GetPropagationCount() == 2);
+            REQUIRE(observed.back() == std::pair<int32_t, int32_t>{4, 3});
+        }
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Propagation Engine Benchmarks")
+    {
+        // The same graph of plain subjects recomputing in OnNotification, the sink runs once per middle node.
+        class EagerNode final
+            : public VectorSubjectSystem::Observer
+            , public Subject<EagerNode, SubjectSystemTag, VectorObserverStorage>::Observer
+            , public Subject<EagerNode, SubjectSystemTag, VectorObserverStorage>
+        {
+        public:
+            explicit EagerNode(std::vector<EagerNode*> upstreams = {})
+                : m_Upstreams{std::move(upstreams)}
+            {
+            }
+
+            bool OnNotification(const VectorSubjectSystem& root, const SubjectSystemTag) override
+            {
+                SetValueA(root.GetValueA());
+                return true;
+            }
+
+            bool OnNotification(const EagerNode&, const SubjectSystemTag) override
+            {
+                int32_t sum{0};
+                for(const EagerNode* const upstream : m_Upstreams)
+                {
+                    sum += upstream->GetValueA();
+                }
+
+                SetValueA(sum);
+                return true;
+            }
+
+            int32_t GetValueA() const { return m_Value; }
+        private:
+            void SetValueA(const int32_t value)
+            {
+                if(std::exchange(m_Value, value) != value)
+                {
+                    SendNotification(SubjectSystemTag::ValueA);
+                }
+            }
+
+            std::vector<EagerNode*> m_Upstreams{};
+            int32_t m_Value{0};
+        };
+
+        // root -> 100 middle nodes -> sink, every middle node changes with the root.
+        constexpr uint32_t middleCount{100};
+        PropagationEngine engine{};
+        VectorSubjectSystem root{};
+        const auto middleCompute{
+            [&root]
+            {
+                return root.GetValueA();
+            }};
+
+        std::vector<std::unique_ptr<PropagationValueNode<decltype(middleCompute)>>> middles{};
+        for(uint32_t i{0}; i != middleCount; ++i)
+        {
+            middles.push_back(std::make_unique<PropagationValueNode<decltype(middleCompute)>>(engine, middleCompute));
+            middles.back()->DependOn(root);
+        }
+
+        PropagationValueNode sink{engine,
+            [&middles]
+            {
+                int32_t sum{0};
+                for(const auto& middle : middles)
+                {
+                    sum += middle->GetValueA();
+                }
+
+                return sum;
+            }};
+        for(const auto& middle : middles)
+        {
+            sink.DependOn(*middle);
+        }
+
+        int32_t value{0};
+        BENCHMARK("Benchmark Propagation - Implicit Transaction")
+        {
+            root.SetValueA(++value);
+        };
+
+        BENCHMARK("Benchmark Propagation - Transaction")
+        {
+            const PropagationEngine::Transaction transaction{engine};
+            root.SetValueA(++value);
+        };
+
+        VectorSubjectSystem eagerRoot{};
+        std::vector<std::unique_ptr<EagerNode>> eagerMiddles{};
+        std::vector<EagerNode*> eagerUpstreams{};
+        for(uint32_t i{0}; i != middleCount; ++i)
+        {
+            eagerMiddles.push_back(std::make_unique<EagerNode>());
+            eagerRoot.AttachObserver(static_cast<VectorSubjectSystem::Observer*>(eagerMiddles.back().get()));
+            eagerUpstreams.push_back(eagerMiddles.back().get());
+        }
+
+        EagerNode eagerSink{std::move(eagerUpstreams)};
+        for(const std::unique_ptr<EagerNode>& middle : eagerMiddles)
+        {
+            middle->AttachObserver(&eagerSink);
+        }
+
+        BENCHMARK("Benchmark Propagation - Eager Observers")
+        {
+            eagerRoot.SetValueA(++value);
+        };
+    }
+}
@@ -0,0 +1,647 @@
+#pragma once
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <array>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cassert>
+
+#include "observerexamples_referencesemantics.h"
+
+namespace ReferenceSemantics
+{
+    // Bounded lock-free ring buffer (Vyukov). Safe for multiple producers and consumers, QueuedSubject uses it with a
+    // single dispatcher consumer and only lets producers pop when dropping the oldest record.
+    template<typename T, size_t CapacityT>
+    class BoundedRingBuffer
+    {
+    public:
+        static_assert(CapacityT >= 2 && (CapacityT & (CapacityT - 1)) == 0, "Capacity must be a power of two");
+
+        BoundedRingBuffer()
+            : m_Cells{std::make_unique<Cell[]>(CapacityT)}
+        {
+            for(size_t i{0}; i != CapacityT; ++i)
+            {
+                m_Cells[i].m_Sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        bool TryPush(const T& value)
+        {
+            size_t position{m_EnqueuePosition.load(std::memory_order_relaxed)};
+            Cell* cell{nullptr};
+            while(true)
+            {
+                cell = &m_Cells[position & Mask];
+                const size_t sequence{cell->m_Sequence.load(std::memory_order_acquire)};
+                const intptr_t difference{static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position)};
+                if(difference == 0)
+                {
+                    if(m_EnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if(difference < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = m_EnqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->m_Value = value;
+            cell->m_Sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool TryPop(T& value)
+        {
+            size_t position{m_DequeuePosition.load(std::memory_order_relaxed)};
+            Cell* cell{nullptr};
+            while(true)
+            {
+                cell = &m_Cells[position & Mask];
+                const size_t sequence{cell->m_Sequence.load(std::memory_order_acquire)};
+                const intptr_t difference{static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1)};
+                if(difference == 0)
+                {
+                    if(m_DequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if(difference < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = m_DequeuePosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            value = std::move(cell->m_Value);
+            cell->m_Sequence.store(position + CapacityT, std::memory_order_release);
+            return true;
+        }
+    private:
+        static constexpr size_t Mask{CapacityT - 1};
+
+        struct Cell
+        {
+            std::atomic<size_t> m_Sequence{0};
+            T m_Value{};
+        };
+
+        std::unique_ptr<Cell[]> m_Cells{};
+        alignas(CacheLineSize) std::atomic<size_t> m_EnqueuePosition{0};
+        alignas(CacheLineSize) std::atomic<size_t> m_DequeuePosition{0};
+    };
+
+    enum class BackpressurePolicy
+    {
+        Block,
+        DropOldest,
+        DropNewest
+    };
+
+    struct QueuedSubjectCounters
+    {
+        uint64_t m_Enqueued{0};
+        uint64_t m_Dispatched{0};
+        uint64_t m_Blocked{0};
+        uint64_t m_DroppedOldest{0};
+        uint64_t m_DroppedNewest{0};
+    };
+
+    template<typename SnapshotT, IsTagEnum TagT>
+    class QueuedObserver
+    {
+    public:
+        virtual ~QueuedObserver() = default;
+        virtual bool OnNotification(const SnapshotT& snapshot, const TagT tag) = 0;
+    };
+
+    // SendNotification pushes a (tag, snapshot) record and returns, observers are notified on a dispatcher thread.
+    // SubjectT builds the snapshot from the value being set, so concurrent producers never publish each other's value.
+    // When the buffer is full the BackpressurePolicy decides whether the producer waits for space, evicts the oldest
+    // record, or discards the new one.
+    // Attach/Detach take a mutex shared with the dispatcher, they must not be called from inside OnNotification.
+    template<typename SubjectT, IsTagEnum TagT, typename SnapshotT, size_t CapacityT = 1024>
+    class QueuedSubject
+    {
+    public:
+        using Observer = QueuedObserver<SnapshotT, TagT>;
+        using Tag = TagT;
+        using TagSet = TagSet<TagT>;
+        using Snapshot = SnapshotT;
+
+        explicit QueuedSubject(const BackpressurePolicy policy = BackpressurePolicy::Block)
+            : m_Policy{policy}
+            , m_Dispatcher{[this](const std::stop_token stopToken){ DispatcherLoop(stopToken); }}
+        {
+        }
+
+        // Records still buffered are dispatched before the dispatcher thread exits.
+        ~QueuedSubject()
+        {
+            m_Dispatcher.request_stop();
+            WakeDispatcher();
+            m_Dispatcher.join();
+        }
+
+        QueuedSubject(const QueuedSubject&) = delete;
+        QueuedSubject& operator=(const QueuedSubject&) = delete;
+
+        void AttachObserver(Observer* const observer, const TagSet tags = TagSet::All())
+        {
+            const std::scoped_lock lock{m_ObserversMutex};
+            tags.ForEach(
+                [this, observer](const Tag tag)
+                {
+                    m_Observers[static_cast<size_t>(tag)].Insert(observer);
+                });
+        }
+
+        void DetachObserver(Observer* const observer, const TagSet tags = TagSet::All())
+        {
+            const std::scoped_lock lock{m_ObserversMutex};
+            tags.ForEach(
+                [this, observer](const Tag tag)
+                {
+                    m_Observers[static_cast<size_t>(tag)].Erase(observer);
+                });
+        }
+
+        QueuedSubjectCounters GetCounters() const
+        {
+            return QueuedSubjectCounters{
+                m_Enqueued.load(),
+                m_Dispatched.load(),
+                m_Blocked.load(),
+                m_DroppedOldest.load(),
+                m_DroppedNewest.load()};
+        }
+
+        // Waits until every record pushed so far has been dispatched or dropped. Calling it from OnNotification would
+        // wait for the dispatcher on itself.
+        void Flush() const
+        {
+            assert(std::this_thread::get_id() != m_Dispatcher.get_id() && "Flush from the dispatcher thread");
+            const uint64_t enqueued{m_Enqueued.load()};
+            for(uint64_t completed{m_Completed.load()}; completed < enqueued; completed = m_Completed.load())
+            {
+                m_Completed.wait(completed);
+            }
+        }
+    protected:
+        void SendNotification(const Tag tag, const SnapshotT& snapshot)
+        {
+            const Record record{tag, snapshot};
+            if(!m_Records.TryPush(record))
+            {
+                switch(m_Policy)
+                {
+                case BackpressurePolicy::Block:
+                    m_Blocked.fetch_add(1, std::memory_order_relaxed);
+                    while(!m_Records.TryPush(record))
+                    {
+                        std::this_thread::yield();
+                    }
+                    break;
+                case BackpressurePolicy::DropOldest:
+                    for(Record oldest{}; !m_Records.TryPush(record);)
+                    {
+                        if(m_Records.TryPop(oldest))
+                        {
+                            m_DroppedOldest.fetch_add(1, std::memory_order_relaxed);
+                            Complete();
+                        }
+                    }
+                    break;
+                case BackpressurePolicy::DropNewest:
+                    m_DroppedNewest.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+            }
+
+            m_Enqueued.fetch_add(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if(m_IsDispatcherWaiting.load())
+            {
+                WakeDispatcher();
+            }
+        }
+    private:
+        struct Record
+        {
+            Tag m_Tag{};
+            SnapshotT m_Snapshot{};
+        };
+
+        void Complete()
+        {
+            m_Completed.fetch_add(1);
+            m_Completed.notify_all();
+        }
+
+        void WakeDispatcher()
+        {
+            m_WakeCount.fetch_add(1);
+            m_WakeCount.notify_one();
+        }
+
+        void DispatcherLoop(const std::stop_token stopToken)
+        {
+            Record record{};
+            while(true)
+            {
+                const uint64_t wakeCount{m_WakeCount.load()};
+                if(m_Records.TryPop(record))
+                {
+                    Dispatch(record);
+                    continue;
+                }
+
+                if(stopToken.stop_requested())
+                {
+                    return;
+                }
+
+                // Producers only notify once the dispatcher announced it is waiting, re-check before sleeping.
+                m_IsDispatcherWaiting.store(true);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if(m_Records.TryPop(record))
+                {
+                    m_IsDispatcherWaiting.store(false);
+                    Dispatch(record);
+                    continue;
+                }
+
+                m_WakeCount.wait(wakeCount);
+                m_IsDispatcherWaiting.store(false);
+            }
+        }
+
+        void Dispatch(const Record& record)
+        {
+            {
+                const std::scoped_lock lock{m_ObserversMutex};
+                m_Observers[static_cast<size_t>(record.m_Tag)].ForEach(
+                    [&record](Observer* const observer)
+                    {
+                        observer->OnNotification(record.m_Snapshot, record.m_Tag);
+                    });
+            }
+
+            m_Dispatched.fetch_add(1, std::memory_order_relaxed);
+            Complete();
+        }
+
+        BoundedRingBuffer<Record, CapacityT> m_Records{};
+        std::array<VectorObserverStorage<Observer>, TagCount<TagT>> m_Observers{};
+        std::mutex m_ObserversMutex{};
+        BackpressurePolicy m_Policy{BackpressurePolicy::Block};
+        alignas(CacheLineSize) std::atomic<uint64_t> m_Enqueued{0};
+        std::atomic<bool> m_IsDispatcherWaiting{false};
+        alignas(CacheLineSize) std::atomic<uint64_t> m_Dispatched{0};
+        // Dispatched plus dropped oldest records, Flush waits on it.
+        std::atomic<uint64_t> m_Completed{0};
+        std::atomic<uint64_t> m_WakeCount{0};
+        std::atomic<uint64_t> m_Blocked{0};
+        std::atomic<uint64_t> m_DroppedOldest{0};
+        std::atomic<uint64_t> m_DroppedNewest{0};
+        std::jthread m_Dispatcher{};
+    };
+
+    struct SubjectSystemSnapshot
+    {
+        int32_t m_ValueA{0};
+        int32_t m_ValueB{0};
+    };
+
+    template<size_t CapacityT>
+    class BasicQueuedSubjectSystem final
+        : public QueuedSubject<BasicQueuedSubjectSystem<CapacityT>, SubjectSystemTag, SubjectSystemSnapshot, CapacityT>
+    {
+    public:
+        using QueuedSubject<BasicQueuedSubjectSystem<CapacityT>, SubjectSystemTag, SubjectSystemSnapshot, CapacityT>::QueuedSubject;
+
+        // Setters may be called from several producers, the other value is the latest one stored by any of them.
+        void SetValueA(const int32_t value)
+        {
+            m_ValueA.store(value, std::memory_order_relaxed);
+            this->SendNotification(SubjectSystemTag::ValueA,
+                SubjectSystemSnapshot{value, m_ValueB.load(std::memory_order_relaxed)});
+        }
+
+        void SetValueB(const int32_t value)
+        {
+            m_ValueB.store(value, std::memory_order_relaxed);
+            this->SendNotification(SubjectSystemTag::ValueB,
+                SubjectSystemSnapshot{m_ValueA.load(std::memory_order_relaxed), value});
+        }
+
+        int32_t GetValueA() const { return m_ValueA.load(std::memory_order_relaxed); }
+        int32_t GetValueB() const { return m_ValueB.load(std::memory_order_relaxed); }
+    private:
+        std::atomic<int32_t> m_ValueA{0};
+        std::atomic<int32_t> m_ValueB{0};
+    };
+
+    using QueuedSubjectSystem = BasicQueuedSubjectSystem<1024>;
+
+    class QueuedSubjectObserverA final : public QueuedObserver<SubjectSystemSnapshot, SubjectSystemTag>
+    {
+    public:
+        bool OnNotification(const SubjectSystemSnapshot& snapshot, const SubjectSystemTag tag) override
+        {
+            if(tag == SubjectSystemTag::ValueA)
+            {
+                m_Value.store(snapshot.m_ValueA);
+                return true;
+            }
+
+            return false;
+        }
+
+        int32_t GetValue() const { return m_Value.load(); }
+    private:
+        std::atomic<int32_t> m_Value{0};
+    };
+
+    class QueuedSubjectObserverB final : public QueuedObserver<SubjectSystemSnapshot, SubjectSystemTag>
+    {
+    public:
+        bool OnNotification(const SubjectSystemSnapshot& snapshot, const SubjectSystemTag tag) override
+        {
+            if(tag == SubjectSystemTag::ValueB)
+            {
+                m_Value.store(snapshot.m_ValueB);
+                return true;
+            }
+
+            return false;
+        }
+
+        int32_t GetValue() const { return m_Value.load(); }
+    private:
+        std::atomic<int32_t> m_Value{0};
+    };
+
+    // Holds the dispatcher inside OnNotification until released, used to fill the buffer deterministically.
+    class BlockingQueuedObserver final : public QueuedObserver<SubjectSystemSnapshot, SubjectSystemTag>
+    {
+    public:
+        bool OnNotification(const SubjectSystemSnapshot&, const SubjectSystemTag) override
+        {
+            m_IsBlocking.store(true);
+            m_IsBlocking.notify_all();
+            m_IsReleased.wait(false);
+            return true;
+        }
+
+        void WaitUntilBlocking() const { m_IsBlocking.wait(false); }
+        void Release()
+        {
+            m_IsReleased.store(true);
+            m_IsReleased.notify_all();
+        }
+    private:
+        std::atomic<bool> m_IsBlocking{false};
+        std::atomic<bool> m_IsReleased{false};
+    };
+
+    // Only touched by the dispatcher thread, read the values after Flush.
+    class RecordingQueuedObserver final : public QueuedObserver<SubjectSystemSnapshot, SubjectSystemTag>
+    {
+    public:
+        bool OnNotification(const SubjectSystemSnapshot& snapshot, const SubjectSystemTag tag) override
+        {
+            if(tag == SubjectSystemTag::ValueA)
+            {
+                m_Values.push_back(snapshot.m_ValueA);
+                return true;
+            }
+
+            return false;
+        }
+
+        const std::vector<int32_t>& GetValues() const { return m_Values; }
+    private:
+        std::vector<int32_t> m_Values{};
+    };
+
+    TEST_CASE("Observer - Reference Semantics - Queued Subject Unit Tests")
+    {
+        SECTION("Dispatch")
+        {
+            QueuedSubjectSystem subject{};
+            QueuedSubjectObserverA observerA{};
+            QueuedSubjectObserverB observerB{};
+            subject.AttachObserver(&observerA);
+            subject.AttachObserver(&observerB, SubjectSystemTag::ValueB);
+
+            subject.SetValueA(1);
+            subject.SetValueB(2);
+            subject.Flush();
+
+            REQUIRE(observerA.GetValue() == 1);
+            REQUIRE(observerB.GetValue() == 2);
+
+            subject.DetachObserver(&observerA);
+            subject.SetValueA(3);
+            subject.Flush();
+
+            REQUIRE(observerA.GetValue() == 1);
+
+            const QueuedSubjectCounters counters{subject.GetCounters()};
+            REQUIRE(counters.m_Enqueued == 3);
+            REQUIRE(counters.m_Dispatched == 3);
+            REQUIRE(counters.m_Blocked == 0);
+            REQUIRE(counters.m_DroppedOldest == 0);
+            REQUIRE(counters.m_DroppedNewest == 0);
+        }
+
+        SECTION("Drop Newest")
+        {
+            BasicQueuedSubjectSystem<4> subject{BackpressurePolicy::DropNewest};
+            BlockingQueuedObserver blocking{};
+            QueuedSubjectObserverA observerA{};
+            subject.AttachObserver(&blocking, SubjectSystemTag::ValueB);
+            subject.AttachObserver(&observerA);
+
+            subject.SetValueB(0);
+            blocking.WaitUntilBlocking();
+            for(int32_t i{1}; i != 7; ++i)
+            {
+                subject.SetValueA(i);
+            }
+
+            blocking.Release();
+            subject.Flush();
+
+            REQUIRE(observerA.GetValue() == 4);
+
+            const QueuedSubjectCounters counters{subject.GetCounters()};
+            REQUIRE(counters.m_Enqueued == 5);
+            REQUIRE(counters.m_Dispatched == 5);
+            REQUIRE(counters.m_DroppedNewest == 2);
+        }
+
+        SECTION("Drop Oldest")
+        {
+            BasicQueuedSubjectSystem<4> subject{BackpressurePolicy::DropOldest};
+            BlockingQueuedObserver blocking{};
+            QueuedSubjectObserverA observerA{};
+            subject.AttachObserver(&blocking, SubjectSystemTag::ValueB);
+            subject.AttachObserver(&observerA);
+
+            subject.SetValueB(0);
+            blocking.WaitUntilBlocking();
+            for(int32_t i{1}; i != 7; ++i)
+            {
+                subject.SetValueA(i);
+            }
+
+            blocking.Release();
+            subject.Flush();
+
+            REQUIRE(observerA.GetValue() == 6);
+
+            const QueuedSubjectCounters counters{subject.GetCounters()};
+            REQUIRE(counters.m_Enqueued == 7);
+            REQUIRE(counters.m_Dispatched == 5);
+            REQUIRE(counters.m_DroppedOldest == 2);
+        }
+
+        SECTION("Block")
+        {
+            BasicQueuedSubjectSystem<4> subject{BackpressurePolicy::Block};
+            BlockingQueuedObserver blocking{};
+            QueuedSubjectObserverA observerA{};
+            subject.AttachObserver(&blocking, SubjectSystemTag::ValueB);
+            subject.AttachObserver(&observerA);
+
+            subject.SetValueB(0);
+            blocking.WaitUntilBlocking();
+            for(int32_t i{1}; i != 5; ++i)
+            {
+                subject.SetValueA(i);
+            }
+
+            // The ring is full while the dispatcher is blocked, the producer must block until it drains.
+            std::atomic<bool> isProduced{false};
+            std::jthread producer{
+                [&subject, &isProduced]
+                {
+                    subject.SetValueA(5);
+                    isProduced.store(true);
+                }};
+
+            while(subject.GetCounters().m_Blocked == 0)
+            {
+                std::this_thread::yield();
+            }
+
+            REQUIRE_FALSE(isProduced.load());
+            REQUIRE(subject.GetCounters().m_Enqueued == 5);
+
+            blocking.Release();
+            producer.join();
+            subject.Flush();
+
+            REQUIRE(isProduced.load());
+            REQUIRE(observerA.GetValue() == 5);
+
+            const QueuedSubjectCounters counters{subject.GetCounters()};
+            REQUIRE(counters.m_Enqueued == 6);
+            REQUIRE(counters.m_Dispatched == 6);
+            REQUIRE(counters.m_Blocked == 1);
+        }
+
+        SECTION("Multiple Producers")
+        {
+            constexpr int32_t producerCount{4};
+            constexpr int32_t valueCount{10'000};
+            BasicQueuedSubjectSystem<64> subject{BackpressurePolicy::Block};
+            RecordingQueuedObserver recording{};
+            subject.AttachObserver(&recording, SubjectSystemTag::ValueA);
+            {
+                std::vector<std::jthread> producers{};
+                for(int32_t producer{0}; producer != producerCount; ++producer)
+                {
+                    producers.emplace_back(
+                        [&subject, producer]
+                        {
+                            for(int32_t i{0}; i != valueCount; ++i)
+                            {
+                                subject.SetValueA(producer * valueCount + i);
+                            }
+                        });
+                }
+            }
+
+            subject.Flush();
+
+            // Every record carries the value its producer set, in that producer's order, so none is lost or repeated.
+            const std::vector<int32_t>& values{recording.GetValues()};
+            REQUIRE(values.size() == static_cast<size_t>(producerCount * valueCount));
+            std::vector<int32_t> lastValues(producerCount, -1);
+            const bool isOrdered{std::all_of(values.begin(), values.end(),
+                [&lastValues](const int32_t value)
+                {
+                    if(value < 0 || value >= producerCount * valueCount)
+                    {
+                        return false;
+                    }
+
+                    int32_t& lastValue{lastValues[static_cast<size_t>(value / valueCount)]};
+                    return std::exchange(lastValue, value) < value;
+                })};
+            REQUIRE(isOrdered);
+
+            const QueuedSubjectCounters counters{subject.GetCounters()};
+            REQUIRE(counters.m_Enqueued == static_cast<uint64_t>(producerCount * valueCount));
+            REQUIRE(counters.m_Dispatched == static_cast<uint64_t>(producerCount * valueCount));
+        }
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Queued Subject Benchmarks")
+    {
+        constexpr uint32_t creationCount{1'000};
+        SubjectSystem subject{};
+        std::vector<std::unique_ptr<SubjectObserverA>> observers{};
+        // Declared before the subject, which dispatches the records still buffered to them when destroyed.
+        std::vector<std::unique_ptr<QueuedSubjectObserverA>> queuedObservers{};
+        QueuedSubjectSystem queuedSubject{BackpressurePolicy::DropNewest};
+        for(uint32_t i{0}; i != creationCount; ++i)
+        {
+            observers.push_back(std::make_unique<SubjectObserverA>());
+            subject.AttachObserver(observers.back().get());
+            queuedObservers.push_back(std::make_unique<QueuedSubjectObserverA>());
+            queuedSubject.AttachObserver(queuedObservers.back().get());
+        }
+
+        BENCHMARK("Benchmark Producer Latency - Subject")
+        {
+            subject.SetValueA(0);
+        };
+
+        BENCHMARK("Benchmark Producer Latency - Queued Subject")
+        {
+            queuedSubject.SetValueA(0);
+        };
+    }
+}
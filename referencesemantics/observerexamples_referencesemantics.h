@@ -5,193 +5,3338 @@
 
 #include <set>
 #include <memory>
+#include <vector>
+#include <unordered_map>
+#include <memory_resource>
+#include <concepts>
+#include <array>
+#include <bitset>
+#include <initializer_list>
+#include <tuple>
+#include <typeinfo>
+#include <utility>
+#include <limits>
+#include <span>
+#include <string>
+#include <chrono>
+#include <bit>
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <random>
+#include <coroutine>
+#include <cassert>
+#include <stdexcept>
+
+#include "observerexamples_workstealingthreadpool.h"
+#include "../benchmarks/observerexamples_benchmarkattachdetach.h"
+#include "../benchmarks/observerexamples_benchmarkobservers.h"
+
+// MSVC ignores the standard attribute for ABI compatibility, other compilers warn about the MSVC spelling.
+#if defined(_MSC_VER)
+#define OBSERVER_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define OBSERVER_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
 
 namespace ReferenceSemantics
 {
     template<typename T>
     concept IsScopedEnum = std::is_scoped_enum_v<T>;
 
-    template<typename SubjectT, IsScopedEnum TagT>
-    class Observer
+    // Tags are required to end with a Count enumerator, used to size per tag storage.
+    template<typename T>
+    concept IsTagEnum = IsScopedEnum<T> && requires { T::Count; };
+
+    template<IsTagEnum TagT>
+    constexpr size_t TagCount{static_cast<size_t>(TagT::Count)};
+
+    template<IsTagEnum TagT>
+    class TagSet
     {
     public:
-        virtual ~Observer() = default;
-        virtual bool OnNotification(const SubjectT& subject, const TagT tag) = 0;
+        TagSet() = default;
+
+        TagSet(const TagT tag)
+        {
+            Insert(tag);
+        }
+
+        TagSet(const std::initializer_list<TagT> tags)
+        {
+            for(const TagT tag : tags)
+            {
+                Insert(tag);
+            }
+        }
+
+        static TagSet All()
+        {
+            TagSet tags{};
+            tags.m_Tags.set();
+            return tags;
+        }
+
+        void Insert(const TagT tag) { m_Tags.set(static_cast<size_t>(tag)); }
+        void Erase(const TagT tag) { m_Tags.reset(static_cast<size_t>(tag)); }
+        bool Contains(const TagT tag) const { return m_Tags.test(static_cast<size_t>(tag)); }
+        bool Empty() const { return m_Tags.none(); }
+
+        TagSet operator|(const TagSet other) const { return TagSet{m_Tags | other.m_Tags}; }
+        TagSet operator&(const TagSet other) const { return TagSet{m_Tags & other.m_Tags}; }
+        TagSet operator~() const { return TagSet{~m_Tags}; }
+        bool operator==(const TagSet&) const = default;
+
+        template<typename VisitorT>
+        void ForEach(VisitorT&& visitor) const
+        {
+            for(size_t i{0}; i != TagCount<TagT>; ++i)
+            {
+                if(m_Tags.test(i))
+                {
+                    visitor(static_cast<TagT>(i));
+                }
+            }
+        }
+    private:
+        explicit TagSet(const std::bitset<TagCount<TagT>> tags)
+            : m_Tags{tags}
+        {
+        }
+
+        std::bitset<TagCount<TagT>> m_Tags{};
+    };
+
+    // Payload type pushed with notifications of TagV, specialized per tag. Tags without a Type only support pull.
+    template<auto TagV>
+    struct TagPayload
+    {
     };
 
+    template<auto TagV>
+    using TagPayloadT = typename TagPayload<TagV>::Type;
+
+    template<auto TagV>
+    concept HasTagPayload = requires { typename TagPayload<TagV>::Type; };
+
+    template<auto TagV>
+    using TagConstant = std::integral_constant<decltype(TagV), TagV>;
+
     template<typename SubjectT, IsScopedEnum TagT>
-    class Subject
+    class Observer
     {
     public:
-        using Observer = Observer<SubjectT, TagT>;
-        using Tag = TagT;
+        virtual ~Observer() = default;
+        virtual bool OnNotification(const SubjectT& subject, const TagT tag) = 0;
 
-        void AttachObserver(Observer* const observer)
+        // Receives notifications sent with a TagPayloadT<tag>, observers that do not override it pull from the subject.
+        virtual bool OnPayloadNotification(const SubjectT& subject, const TagT tag, const void* const)
         {
-            m_Observers.insert(observer);
+            return OnNotification(subject, tag);
         }
+    };
 
-        void DetachObserver(Observer* const observer)
+    // Observer receiving pushed payloads as typed values. DerivedT declares an overload per tag it takes the payload of,
+    // by value for small payloads so it arrives in a register:
+    // bool OnPayload(const SubjectT& subject, TagConstant<Tag::Value>, const TagPayloadT<Tag::Value> payload)
+    // Tags without an overload, and notifications sent without a payload, go to OnNotification(subject, tag).
+    template<typename DerivedT, typename SubjectT, IsScopedEnum TagT>
+    class PayloadObserver : public Observer<SubjectT, TagT>
+    {
+    public:
+        bool OnPayloadNotification(const SubjectT& subject, const TagT tag, const void* const payload) override
         {
-            m_Observers.erase(observer);
+            return [this, &subject, tag, payload]<size_t... IndicesT>(std::index_sequence<IndicesT...>)
+            {
+                bool isHandled{false};
+                ((static_cast<size_t>(tag) == IndicesT
+                    && (isHandled = ReceivePayload<static_cast<TagT>(IndicesT)>(subject, payload), true)) || ...);
+                return isHandled;
+            }(std::make_index_sequence<TagCount<TagT>>{});
         }
-    protected:
-        void SendNotification(const Tag tag) const
+    private:
+        template<TagT TagV>
+        bool ReceivePayload(const SubjectT& subject, const void* const payload)
         {
-            for(Observer* const observer : m_Observers)
+            DerivedT& derived{static_cast<DerivedT&>(*this)};
+            if constexpr(HasTagPayload<TagV>)
             {
-                observer->OnNotification(static_cast<const SubjectT&>(*this), tag);
+                if constexpr(requires { derived.OnPayload(subject, TagConstant<TagV>{}, std::declval<const TagPayloadT<TagV>&>()); })
+                {
+                    return derived.OnPayload(subject, TagConstant<TagV>{}, *static_cast<const TagPayloadT<TagV>*>(payload));
+                }
             }
+
+            return this->OnNotification(subject, TagV);
         }
-    private:
-        std::set<Observer*> m_Observers{};
     };
 
-    enum class SubjectSystemTag
+    // Observers declare they can be notified concurrently with other observers with a static IsThreadSafe member.
+    template<typename ObserverT>
+    concept IsThreadSafeObserver = requires { requires ObserverT::IsThreadSafe; };
+
+    // Compact handle to an attached observer, a 32-bit slot index plus the slot's generation when it was issued.
+    class ObserverHandle
     {
-        ValueA,
-        ValueB,
+    public:
+        ObserverHandle() = default;
+
+        ObserverHandle(const uint32_t index, const uint32_t generation)
+            : m_Index{index}
+            , m_Generation{generation}
+        {
+        }
+
+        uint32_t GetIndex() const { return m_Index; }
+        uint32_t GetGeneration() const { return m_Generation; }
+        bool IsValid() const { return m_Index != InvalidIndex; }
+
+        bool operator==(const ObserverHandle&) const = default;
+
+        static constexpr uint32_t InvalidIndex{std::numeric_limits<uint32_t>::max()};
+    private:
+        uint32_t m_Index{InvalidIndex};
+        uint32_t m_Generation{0};
     };
 
-    class SubjectSystem final : public Subject<SubjectSystem, SubjectSystemTag>
+    // One slot per attached observer holding the tags it is subscribed to. Released slots bump their generation,
+    // so handles issued before the release are rejected by a single compare.
+    template<typename ObserverT, IsTagEnum TagT>
+    class ObserverSlotMap
     {
     public:
-        void SetValueA(const int32_t value)
+        explicit ObserverSlotMap(std::pmr::memory_resource* const resource = std::pmr::get_default_resource())
+            : m_Slots{resource}
+            , m_Indices{resource}
         {
-            m_ValueA = value;
-            SendNotification(SubjectSystemTag::ValueA);
         }
 
-        void SetValueB(const int32_t value)
+        ObserverHandle Acquire(ObserverT* const observer, const bool isThreadSafe)
         {
-            m_ValueB = value;
-            SendNotification(SubjectSystemTag::ValueB);
+            const auto [it, inserted]{m_Indices.try_emplace(observer, m_FreeIndex)};
+            if(!inserted)
+            {
+                return ObserverHandle{it->second, m_Slots[it->second].m_Generation};
+            }
+
+            if(m_FreeIndex != ObserverHandle::InvalidIndex)
+            {
+                m_FreeIndex = m_Slots[m_FreeIndex].m_NextFreeIndex;
+            }
+            else
+            {
+                it->second = static_cast<uint32_t>(m_Slots.size());
+                m_Slots.emplace_back();
+            }
+
+            Slot& slot{m_Slots[it->second]};
+            slot.m_Observer = observer;
+            slot.m_IsThreadSafe = isThreadSafe;
+            return ObserverHandle{it->second, slot.m_Generation};
         }
 
-        int32_t GetValueA() const{ return m_ValueA; }
-        int32_t GetValueB() const { return m_ValueB; }
+        void Release(const ObserverHandle handle)
+        {
+            Slot& slot{m_Slots[handle.GetIndex()]};
+            m_Indices.erase(slot.m_Observer);
+            slot.m_Observer = nullptr;
+            slot.m_Tags = TagSet<TagT>{};
+            ++slot.m_Generation;
+            slot.m_NextFreeIndex = m_FreeIndex;
+            m_FreeIndex = handle.GetIndex();
+        }
+
+        ObserverHandle Find(ObserverT* const observer) const
+        {
+            const auto it{m_Indices.find(observer)};
+            return it != m_Indices.end() ? ObserverHandle{it->second, m_Slots[it->second].m_Generation} : ObserverHandle{};
+        }
+
+        bool IsValid(const ObserverHandle handle) const
+        {
+            return handle.GetIndex() < m_Slots.size()
+                && m_Slots[handle.GetIndex()].m_Generation == handle.GetGeneration()
+                && m_Slots[handle.GetIndex()].m_Observer != nullptr;
+        }
+
+        ObserverT* GetObserver(const ObserverHandle handle) const { return m_Slots[handle.GetIndex()].m_Observer; }
+        bool IsThreadSafe(const ObserverHandle handle) const { return m_Slots[handle.GetIndex()].m_IsThreadSafe; }
+        TagSet<TagT>& GetTags(const ObserverHandle handle) { return m_Slots[handle.GetIndex()].m_Tags; }
     private:
-        int32_t m_ValueA{0};
-        int32_t m_ValueB{0};
+        struct Slot
+        {
+            ObserverT* m_Observer{nullptr};
+            TagSet<TagT> m_Tags{};
+            uint32_t m_Generation{0};
+            uint32_t m_NextFreeIndex{ObserverHandle::InvalidIndex};
+            bool m_IsThreadSafe{false};
+        };
+
+        std::pmr::vector<Slot> m_Slots{};
+        std::pmr::unordered_map<ObserverT*, uint32_t> m_Indices{};
+        uint32_t m_FreeIndex{ObserverHandle::InvalidIndex};
     };
 
-    class SubjectObserverA final : public SubjectSystem::Observer
+    // Ordered by pointer address, attach/detach are O(log n) and notification walks a node based tree.
+    template<typename ObserverT, typename AllocatorT = std::allocator<ObserverT*>>
+    class SetObserverStorage
     {
     public:
-        bool OnNotification(const SubjectSystem& subject, const SubjectSystem::Tag tag) override
+        SetObserverStorage() = default;
+
+        explicit SetObserverStorage(const AllocatorT& allocator)
+            : m_Observers{allocator}
+        {
+        }
+
+        bool Insert(ObserverT* const observer)
         {
-            if(tag == SubjectSystem::Tag::ValueA)
+            return m_Observers.insert(observer).second;
+        }
+
+        bool Erase(ObserverT* const observer)
+        {
+            return m_Observers.erase(observer) != 0;
+        }
+
+        template<typename VisitorT>
+        void ForEach(VisitorT&& visitor) const
+        {
+            for(ObserverT* const observer : m_Observers)
             {
-                m_Value = subject.GetValueA();
-                return true;
+                visitor(observer);
             }
+        }
 
-            return false;
+        template<typename VisitorT>
+        bool ForEachWhile(VisitorT&& visitor) const
+        {
+            for(ObserverT* const observer : m_Observers)
+            {
+                if(!visitor(observer))
+                {
+                    return false;
+                }
+            }
+
+            return true;
         }
 
-        int32_t GetValue() const { return m_Value; }
+        size_t Size() const { return m_Observers.size(); }
     private:
-        int32_t m_Value{0};
+        std::set<ObserverT*, std::less<ObserverT*>, AllocatorT> m_Observers{};
     };
 
-    class SubjectObserverB final : public SubjectSystem::Observer
+    // Contiguous storage, notification is a linear walk over an array of pointers.
+    // Detach swaps the last observer into the detached observer's stored index, so it does not preserve attach order.
+    template<typename ObserverT, typename AllocatorT = std::allocator<ObserverT*>>
+    class VectorObserverStorage
     {
     public:
-        bool OnNotification(const SubjectSystem& subject, const SubjectSystem::Tag tag) override
+        VectorObserverStorage() = default;
+
+        explicit VectorObserverStorage(const AllocatorT& allocator)
+            : m_Observers{allocator}
+            , m_Indices{IndexAllocatorT{allocator}}
+        {
+        }
+
+        bool Insert(ObserverT* const observer)
         {
-            if(tag == SubjectSystem::Tag::ValueB)
+            if(!m_Indices.try_emplace(observer, m_Observers.size()).second)
             {
-                m_Value = subject.GetValueB();
-                return true;
+                return false;
             }
 
-            return false;
+            m_Observers.push_back(observer);
+            return true;
         }
 
-        int32_t GetValue() const { return m_Value; }
+        bool Erase(ObserverT* const observer)
+        {
+            const auto it{m_Indices.find(observer)};
+            if(it == m_Indices.end())
+            {
+                return false;
+            }
+
+            const size_t index{it->second};
+            m_Indices.erase(it);
+
+            ObserverT* const last{m_Observers.back()};
+            m_Observers.pop_back();
+            if(last != observer)
+            {
+                m_Observers[index] = last;
+                m_Indices[last] = index;
+            }
+
+            return true;
+        }
+
+        template<typename VisitorT>
+        void ForEach(VisitorT&& visitor) const
+        {
+            for(ObserverT* const observer : m_Observers)
+            {
+                visitor(observer);
+            }
+        }
+
+        template<typename VisitorT>
+        bool ForEachWhile(VisitorT&& visitor) const
+        {
+            for(ObserverT* const observer : m_Observers)
+            {
+                if(!visitor(observer))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        size_t Size() const { return m_Observers.size(); }
+        std::span<ObserverT* const> GetSpan() const { return m_Observers; }
     private:
-        int32_t m_Value{0};
+        using IndexAllocatorT = typename std::allocator_traits<AllocatorT>::template rebind_alloc<
+            std::pair<ObserverT* const, size_t>>;
+
+        std::vector<ObserverT*, AllocatorT> m_Observers{};
+        std::unordered_map<ObserverT*, size_t, std::hash<ObserverT*>, std::equal_to<ObserverT*>, IndexAllocatorT> m_Indices{};
     };
 
-    TEST_CASE("Observer - Reference Semantics - Unit Tests")
+    // Opt-in list of final Observer types for TypeGroupedObserverStorage, specialized per Observer interface.
+    template<typename ObserverT>
+    struct ObserverTypeGroups
     {
-        SubjectSystem subject{};
-        SubjectObserverA observerA{};
-        SubjectObserverB observerB{};
-        SubjectObserverB observerBB{};
-        REQUIRE(subject.GetValueA() == 0);
-        REQUIRE(subject.GetValueB() == 0);
-        REQUIRE(observerA.GetValue() == 0);
-        REQUIRE(observerB.GetValue() == 0);
-        REQUIRE(observerBB.GetValue() == 0);
+        using Types = std::tuple<>;
+    };
 
-        REQUIRE(observerA.OnNotification(subject, SubjectSystemTag::ValueA));
-        REQUIRE_FALSE(observerA.OnNotification(subject, SubjectSystemTag::ValueB));
-        REQUIRE(observerB.OnNotification(subject, SubjectSystemTag::ValueB));
-        REQUIRE_FALSE(observerB.OnNotification(subject, SubjectSystemTag::ValueA));
-        REQUIRE(observerBB.OnNotification(subject, SubjectSystemTag::ValueB));
-        REQUIRE_FALSE(observerBB.OnNotification(subject, SubjectSystemTag::ValueA));
+    // Buckets observers by their dynamic type at attach time, using the types listed in ObserverTypeGroups.
+    // Notification runs one loop per bucket calling the final type directly, so the calls are devirtualized and a
+    // mixed observer set does not mispredict the call target. Unlisted types fall back to a virtually dispatched bucket.
+    template<typename ObserverT>
+    class TypeGroupedObserverStorage
+    {
+    public:
+        TypeGroupedObserverStorage()
+            : m_Buckets(std::tuple_size_v<Types<>> + 1)
+        {
+        }
 
-        REQUIRE(subject.GetValueA() == 0);
-        REQUIRE(subject.GetValueB() == 0);
-        REQUIRE(observerA.GetValue() == 0);
-        REQUIRE(observerB.GetValue() == 0);
-        REQUIRE(observerBB.GetValue() == 0);
+        bool Insert(ObserverT* const observer)
+        {
+            return m_Buckets[GetBucketIndex(typeid(*observer))].Insert(observer);
+        }
 
-        subject.AttachObserver(&observerA);
-        subject.AttachObserver(&observerB);
-        subject.AttachObserver(&observerBB);
+        bool Erase(ObserverT* const observer)
+        {
+            for(VectorObserverStorage<ObserverT>& bucket : m_Buckets)
+            {
+                if(bucket.Erase(observer))
+                {
+                    return true;
+                }
+            }
 
-        subject.SetValueA(1);
+            return false;
+        }
 
-        REQUIRE(subject.GetValueA() == 1);
-        REQUIRE(subject.GetValueB() == 0);
-        REQUIRE(observerA.GetValue() == 1);
-        REQUIRE(observerB.GetValue() == 0);
-        REQUIRE(observerBB.GetValue() == 0);
+        template<typename VisitorT>
+        void ForEach(VisitorT&& visitor) const
+        {
+            [this, &visitor]<size_t... IndicesT>(std::index_sequence<IndicesT...>)
+            {
+                (ForEachInBucket<std::tuple_element_t<IndicesT, Types<>>>(m_Buckets[IndicesT], visitor), ...);
+            }(std::make_index_sequence<std::tuple_size_v<Types<>>>{});
 
-        subject.SetValueB(2);
+            m_Buckets.back().ForEach(visitor);
+        }
 
-        REQUIRE(subject.GetValueA() == 1);
-        REQUIRE(subject.GetValueB() == 2);
-        REQUIRE(observerA.GetValue() == 1);
-        REQUIRE(observerB.GetValue() == 2);
-        REQUIRE(observerBB.GetValue() == 2);
+        template<typename VisitorT>
+        bool ForEachWhile(VisitorT&& visitor) const
+        {
+            const bool isComplete{[this, &visitor]<size_t... IndicesT>(std::index_sequence<IndicesT...>)
+            {
+                return (ForEachInBucketWhile<std::tuple_element_t<IndicesT, Types<>>>(m_Buckets[IndicesT], visitor) && ...);
+            }(std::make_index_sequence<std::tuple_size_v<Types<>>>{})};
 
-        subject.DetachObserver(&observerBB);
-        subject.SetValueB(3);
+            return isComplete && m_Buckets.back().ForEachWhile(visitor);
+        }
 
-        REQUIRE(subject.GetValueA() == 1);
-        REQUIRE(subject.GetValueB() == 3);
-        REQUIRE(observerA.GetValue() == 1);
-        REQUIRE(observerB.GetValue() == 3);
-        REQUIRE(observerBB.GetValue() == 2);
-    }
+        size_t Size() const
+        {
+            size_t size{0};
+            for(const VectorObserverStorage<ObserverT>& bucket : m_Buckets)
+            {
+                size += bucket.Size();
+            }
 
-    TEST_CASE("Observer - Reference Semantics - Benchmarks")
+            return size;
+        }
+    private:
+        // Looked up lazily so ObserverTypeGroups can be specialized after the Subject using this storage is declared.
+        template<typename T = ObserverT>
+        using Types = typename ObserverTypeGroups<T>::Types;
+
+        static size_t GetBucketIndex(const std::type_info& type)
+        {
+            size_t index{std::tuple_size_v<Types<>>};
+            [&index, &type]<size_t... IndicesT>(std::index_sequence<IndicesT...>)
+            {
+                ((typeid(std::tuple_element_t<IndicesT, Types<>>) == type ? (index = IndicesT, true) : false) || ...);
+            }(std::make_index_sequence<std::tuple_size_v<Types<>>>{});
+
+            return index;
+        }
+
+        template<typename ConcreteObserverT, typename VisitorT>
+        static void ForEachInBucket(const VectorObserverStorage<ObserverT>& bucket, VisitorT& visitor)
+        {
+            static_assert(std::derived_from<ConcreteObserverT, ObserverT> && std::is_final_v<ConcreteObserverT>,
+                "Grouped observer types must be final to be devirtualized");
+
+            bucket.ForEach(
+                [&visitor](ObserverT* const observer)
+                {
+                    visitor(static_cast<ConcreteObserverT*>(observer));
+                });
+        }
+
+        template<typename ConcreteObserverT, typename VisitorT>
+        static bool ForEachInBucketWhile(const VectorObserverStorage<ObserverT>& bucket, VisitorT& visitor)
+        {
+            return bucket.ForEachWhile(
+                [&visitor](ObserverT* const observer)
+                {
+                    return visitor(static_cast<ConcreteObserverT*>(observer));
+                });
+        }
+
+        std::vector<VectorObserverStorage<ObserverT>> m_Buckets{};
+    };
+
+    constexpr int32_t DefaultObserverPriority{0};
+
+    // Contiguous storage sorted by descending priority, observers with equal priority keep their attach order.
+    // Attach is a binary search plus a shift of the lower priority observers, nothing is sorted per notification.
+    // Parallel notifications split the observers into chunks and do not follow the priority order.
+    template<typename ObserverT, typename AllocatorT = std::allocator<ObserverT*>>
+    class PriorityObserverStorage
     {
-        constexpr uint32_t creationCount{250'000};
-        SubjectSystem subject{};
-        std::vector<std::shared_ptr<SubjectSystem::Observer>> observers{};
-        observers.reserve(creationCount);
-        for(uint32_t i{0}; i != creationCount; ++i)
+    public:
+        PriorityObserverStorage() = default;
+
+        explicit PriorityObserverStorage(const AllocatorT& allocator)
+            : m_Observers{allocator}
+            , m_SortedPriorities{PriorityAllocatorT{allocator}}
+            , m_Priorities{PriorityMapAllocatorT{allocator}}
         {
-            std::shared_ptr<SubjectSystem::Observer> observer{std::make_unique<SubjectObserverA>()};
-            observers.push_back(observer);
-            subject.AttachObserver(observer.get());
         }
 
-        BENCHMARK("Benchmark Attach")
+        bool Insert(ObserverT* const observer)
+        {
+            return Insert(observer, DefaultObserverPriority);
+        }
+
+        bool Insert(ObserverT* const observer, const int32_t priority)
         {
-            for(std::shared_ptr<SubjectSystem::Observer>& observer : observers)
+            if(!m_Priorities.try_emplace(observer, priority).second)
             {
-                subject.AttachObserver(observer.get());
+                return false;
             }
-        };
 
-        BENCHMARK("Benchmark Notification")
+            const auto it{std::upper_bound(m_SortedPriorities.begin(), m_SortedPriorities.end(), priority,
+                std::greater<int32_t>{})};
+            const ptrdiff_t index{it - m_SortedPriorities.begin()};
+            m_SortedPriorities.insert(it, priority);
+            m_Observers.insert(m_Observers.begin() + index, observer);
+            return true;
+        }
+
+        bool Erase(ObserverT* const observer)
         {
-            subject.SetValueA(0);
+            const auto it{m_Priorities.find(observer)};
+            if(it == m_Priorities.end())
+            {
+                return false;
+            }
+
+            const auto [first, last]{std::equal_range(m_SortedPriorities.begin(), m_SortedPriorities.end(), it->second,
+                std::greater<int32_t>{})};
+            const auto observerIt{std::find(m_Observers.begin() + (first - m_SortedPriorities.begin()),
+                m_Observers.begin() + (last - m_SortedPriorities.begin()), observer)};
+            m_SortedPriorities.erase(m_SortedPriorities.begin() + (observerIt - m_Observers.begin()));
+            m_Observers.erase(observerIt);
+            m_Priorities.erase(it);
+            return true;
+        }
+
+        template<typename VisitorT>
+        void ForEach(VisitorT&& visitor) const
+        {
+            for(ObserverT* const observer : m_Observers)
+            {
+                visitor(observer);
+            }
+        }
+
+        template<typename VisitorT>
+        bool ForEachWhile(VisitorT&& visitor) const
+        {
+            for(ObserverT* const observer : m_Observers)
+            {
+                if(!visitor(observer))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        size_t Size() const { return m_Observers.size(); }
+        std::span<ObserverT* const> GetSpan() const { return m_Observers; }
+    private:
+        using PriorityAllocatorT = typename std::allocator_traits<AllocatorT>::template rebind_alloc<int32_t>;
+        using PriorityMapAllocatorT = typename std::allocator_traits<AllocatorT>::template rebind_alloc<
+            std::pair<ObserverT* const, int32_t>>;
+
+        std::vector<ObserverT*, AllocatorT> m_Observers{};
+        std::vector<int32_t, PriorityAllocatorT> m_SortedPriorities{};
+        std::unordered_map<ObserverT*, int32_t, std::hash<ObserverT*>, std::equal_to<ObserverT*>, PriorityMapAllocatorT>
+            m_Priorities{};
+    };
+
+    // Storages allocating from a std::pmr::memory_resource, passed to the Subject constructor taking a resource.
+    template<typename ObserverT>
+    using PmrSetObserverStorage = SetObserverStorage<ObserverT, std::pmr::polymorphic_allocator<ObserverT*>>;
+
+    template<typename ObserverT>
+    using PmrVectorObserverStorage = VectorObserverStorage<ObserverT, std::pmr::polymorphic_allocator<ObserverT*>>;
+
+    template<typename ObserverT>
+    using PmrPriorityObserverStorage = PriorityObserverStorage<ObserverT, std::pmr::polymorphic_allocator<ObserverT*>>;
+
+    // ForEachWhile stops at the first observer the visitor returns false for, and then returns false itself.
+    template<typename T, typename ObserverT>
+    concept IsObserverStorage = requires(T storage, const T constStorage, ObserverT* const observer)
+    {
+        { storage.Insert(observer) } -> std::same_as<bool>;
+        { storage.Erase(observer) } -> std::same_as<bool>;
+        { constStorage.ForEach([](ObserverT* const){}) };
+        { constStorage.ForEachWhile([](ObserverT* const){ return true; }) } -> std::same_as<bool>;
+        { constStorage.Size() } -> std::same_as<size_t>;
+    };
+
+    template<typename T, typename ObserverT>
+    concept IsContiguousObserverStorage = IsObserverStorage<T, ObserverT> && requires(const T constStorage)
+    {
+        { constStorage.GetSpan() } -> std::same_as<std::span<ObserverT* const>>;
+    };
+
+    template<typename T, typename ObserverT>
+    concept IsPriorityObserverStorage = IsContiguousObserverStorage<T, ObserverT>
+        && requires(T storage, ObserverT* const observer, const int32_t priority)
+    {
+        { storage.Insert(observer, priority) } -> std::same_as<bool>;
+    };
+
+    // Folds the bool returned by each OnNotification into a result while the notification is sent.
+    // Reduce returns false to stop the notification before the remaining observers are visited.
+    template<typename T>
+    concept IsNotificationReducer = requires(T reducer, const T constReducer, const bool isHandled)
+    {
+        { reducer.Reduce(isHandled) } -> std::same_as<bool>;
+        { constReducer.GetResult() };
+    };
+
+    // True if any observer handled the notification, every observer is still notified.
+    class AnyHandledReducer
+    {
+    public:
+        bool Reduce(const bool isHandled)
+        {
+            m_IsHandled = m_IsHandled || isHandled;
+            return true;
+        }
+
+        bool GetResult() const { return m_IsHandled; }
+    private:
+        bool m_IsHandled{false};
+    };
+
+    // True if every observer handled the notification, or if there were no observers.
+    class AllHandledReducer
+    {
+    public:
+        bool Reduce(const bool isHandled)
+        {
+            m_IsHandled = m_IsHandled && isHandled;
+            return true;
+        }
+
+        bool GetResult() const { return m_IsHandled; }
+    private:
+        bool m_IsHandled{true};
+    };
+
+    class CountHandledReducer
+    {
+    public:
+        bool Reduce(const bool isHandled)
+        {
+            m_Count += isHandled ? 1 : 0;
+            return true;
+        }
+
+        size_t GetResult() const { return m_Count; }
+    private:
+        size_t m_Count{0};
+    };
+
+    // Stops at the first observer that handles the notification, the remaining observers are not notified.
+    class FirstHandledReducer
+    {
+    public:
+        bool Reduce(const bool isHandled)
+        {
+            m_IsHandled = isHandled;
+            return !isHandled;
+        }
+
+        bool GetResult() const { return m_IsHandled; }
+    private:
+        bool m_IsHandled{false};
+    };
+
+    // Custom fold, result = func(result, isHandled) for every observer.
+    template<typename ResultT, typename FuncT>
+    class FoldReducer
+    {
+    public:
+        FoldReducer(const ResultT initial, FuncT func)
+            : m_Result{initial}
+            , m_Func{std::move(func)}
+        {
+        }
+
+        bool Reduce(const bool isHandled)
+        {
+            m_Result = m_Func(m_Result, isHandled);
+            return true;
+        }
+
+        ResultT GetResult() const { return m_Result; }
+    private:
+        ResultT m_Result{};
+        FuncT m_Func;
+    };
+
+    // Default instrumentation policy, SendNotification compiles without any timing.
+    template<typename ObserverT, typename TagT>
+    struct NoInstrumentation
+    {
+        static constexpr bool IsEnabled{false};
+    };
+
+    // Log-bucketed latency histogram in nanoseconds. Each power of two is split into 8 linear sub-buckets so
+    // percentiles are reported within 12.5% of the recorded value, durations below 8ns are exact. Durations from 2^30ns,
+    // about 1s, share the last bucket and report GetMax. 224 saturating 32-bit buckets keep a histogram under 1KB.
+    class LatencyHistogram
+    {
+    public:
+        void Record(const std::chrono::nanoseconds duration)
+        {
+            const uint64_t value{static_cast<uint64_t>(std::max(duration.count(), int64_t{0}))};
+            uint32_t& bucket{m_Buckets[GetBucketIndex(value)]};
+            bucket += bucket != std::numeric_limits<uint32_t>::max() ? 1 : 0;
+            ++m_Count;
+            m_Max = std::max(m_Max, value);
+        }
+
+        // Returns the highest duration that falls in the same bucket as the requested percentile, in [0, 100].
+        std::chrono::nanoseconds GetPercentile(const double percentile) const
+        {
+            if(m_Count == 0)
+            {
+                return std::chrono::nanoseconds{0};
+            }
+
+            const uint64_t rank{std::max(static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(m_Count) + 0.5),
+                uint64_t{1})};
+            uint64_t seen{0};
+            for(size_t i{0}; i != BucketCount - 1; ++i)
+            {
+                seen += m_Buckets[i];
+                if(seen >= rank)
+                {
+                    return std::chrono::nanoseconds{static_cast<int64_t>(std::min(GetBucketHighestValue(i), m_Max))};
+                }
+            }
+
+            return GetMax();
+        }
+
+        std::chrono::nanoseconds GetMax() const { return std::chrono::nanoseconds{static_cast<int64_t>(m_Max)}; }
+        uint64_t GetCount() const { return m_Count; }
+    private:
+        static constexpr uint32_t SubBucketBits{3};
+        static constexpr uint64_t SubBucketCount{uint64_t{1} << SubBucketBits};
+        static constexpr uint32_t MaxValueBits{30};
+        static constexpr size_t BucketCount{(MaxValueBits - SubBucketBits + 1) * SubBucketCount};
+
+        static size_t GetBucketIndex(const uint64_t value)
+        {
+            if(value < SubBucketCount)
+            {
+                return static_cast<size_t>(value);
+            }
+
+            if(value >> MaxValueBits != 0)
+            {
+                return BucketCount - 1;
+            }
+
+            const uint32_t shift{static_cast<uint32_t>(std::bit_width(value)) - 1 - SubBucketBits};
+            return static_cast<size_t>((shift + 1) * SubBucketCount + ((value >> shift) & (SubBucketCount - 1)));
+        }
+
+        static uint64_t GetBucketHighestValue(const size_t index)
+        {
+            if(index < SubBucketCount)
+            {
+                return index;
+            }
+
+            const uint64_t shift{index / SubBucketCount - 1};
+            return ((SubBucketCount + index % SubBucketCount + 1) << shift) - 1;
+        }
+
+        std::array<uint32_t, BucketCount> m_Buckets{};
+        uint64_t m_Count{0};
+        uint64_t m_Max{0};
+    };
+
+    // Times every OnNotification call with steady_clock and records it per observer and per tag. Calls slower than
+    // the threshold are counted against their observer. Observer statistics are kept in a dense vector indexed by the
+    // observer's handle and dropped once the observer is detached from every tag, a handle reusing the slot starts empty.
+    // Observers notified in flight after their detach are only recorded in the tag histograms.
+    template<typename ObserverT, typename TagT>
+    class LatencyInstrumentation
+    {
+    public:
+        static constexpr bool IsEnabled{true};
+
+        void Record(const ObserverHandle handle, const ObserverT* const observer, const TagT tag,
+            const std::chrono::nanoseconds duration)
+        {
+            m_TagHistograms[static_cast<size_t>(tag)].Record(duration);
+            if(!handle.IsValid())
+            {
+                return;
+            }
+
+            if(handle.GetIndex() >= m_ObserverStats.size())
+            {
+                m_ObserverStats.resize(handle.GetIndex() + 1);
+            }
+
+            ObserverStats& stats{m_ObserverStats[handle.GetIndex()]};
+            stats.m_Observer = observer;
+            stats.m_Generation = handle.GetGeneration();
+            stats.m_Histogram.Record(duration);
+            stats.m_SlowCallCount += duration > m_SlowThreshold ? 1 : 0;
+        }
+
+        // Called by the subject when the handle's slot is released.
+        void Release(const ObserverHandle handle)
+        {
+            if(handle.GetIndex() < m_ObserverStats.size())
+            {
+                m_ObserverStats[handle.GetIndex()] = ObserverStats{};
+            }
+        }
+
+        void SetSlowThreshold(const std::chrono::nanoseconds threshold) { m_SlowThreshold = threshold; }
+        std::chrono::nanoseconds GetSlowThreshold() const { return m_SlowThreshold; }
+
+        // Returns nullptr for a stale handle or an observer that was not notified since it was attached.
+        const LatencyHistogram* GetObserverHistogram(const ObserverHandle handle) const
+        {
+            const ObserverStats* const stats{FindStats(handle)};
+            return stats != nullptr ? &stats->m_Histogram : nullptr;
+        }
+
+        const LatencyHistogram& GetTagHistogram(const TagT tag) const
+        {
+            return m_TagHistograms[static_cast<size_t>(tag)];
+        }
+
+        // Observers with at least one call slower than the threshold, with the number of such calls.
+        std::vector<std::pair<const ObserverT*, uint64_t>> GetSlowObservers() const
+        {
+            std::vector<std::pair<const ObserverT*, uint64_t>> slowObservers{};
+            for(const ObserverStats& stats : m_ObserverStats)
+            {
+                if(stats.m_SlowCallCount != 0)
+                {
+                    slowObservers.emplace_back(stats.m_Observer, stats.m_SlowCallCount);
+                }
+            }
+
+            return slowObservers;
+        }
+
+        void Reset()
+        {
+            m_ObserverStats.clear();
+            m_TagHistograms = {};
+        }
+    private:
+        struct ObserverStats
+        {
+            const ObserverT* m_Observer{nullptr};
+            uint32_t m_Generation{0};
+            uint64_t m_SlowCallCount{0};
+            LatencyHistogram m_Histogram{};
+        };
+
+        const ObserverStats* FindStats(const ObserverHandle handle) const
+        {
+            if(!handle.IsValid() || handle.GetIndex() >= m_ObserverStats.size())
+            {
+                return nullptr;
+            }
+
+            const ObserverStats& stats{m_ObserverStats[handle.GetIndex()]};
+            return stats.m_Observer != nullptr && stats.m_Generation == handle.GetGeneration() ? &stats : nullptr;
+        }
+
+        std::vector<ObserverStats> m_ObserverStats{};
+        std::array<LatencyHistogram, TagCount<TagT>> m_TagHistograms{};
+        std::chrono::nanoseconds m_SlowThreshold{std::chrono::nanoseconds::max()};
+    };
+
+    template<typename ExecutorT>
+    concept IsCoroutineExecutor = requires(ExecutorT& executor, const std::coroutine_handle<> handle)
+    {
+        executor.Schedule(handle);
+    };
+
+    // Resumes the coroutine on the calling thread.
+    struct InlineExecutor
+    {
+        void Schedule(const std::coroutine_handle<> handle) const { handle.resume(); }
+    };
+
+    // Payload of a Property tag, see Subject::SetProperty.
+    template<typename T>
+    struct PropertyChange
+    {
+        T m_OldValue;
+        T m_NewValue;
+    };
+
+    // Value owned by a Subject and notified under TagV, whose TagPayload must be PropertyChange<T>.
+    template<std::equality_comparable T, auto TagV>
+        requires std::same_as<TagPayloadT<TagV>, PropertyChange<T>>
+    class Property
+    {
+    public:
+        static constexpr auto Tag{TagV};
+
+        Property() = default;
+
+        explicit Property(T value)
+            : m_Value{std::move(value)}
+        {
+        }
+
+        const T& Get() const { return m_Value; }
+
+        // Stores the value, returns the change only if it differs from the current value.
+        std::optional<PropertyChange<T>> Exchange(T value)
+        {
+            if(m_Value == value)
+            {
+                return std::nullopt;
+            }
+
+            PropertyChange<T> change{std::exchange(m_Value, std::move(value)), m_Value};
+            return change;
+        }
+    private:
+        T m_Value{};
+    };
+
+    // Keeps one dispatch list per tag, a notification only visits the observers subscribed to its tag.
+    // Attaching returns a generational handle, detaching by handle is a slot lookup plus the storage's erase.
+    // Attach/Detach called while a notification is being sent are queued and applied once the outermost notification
+    // returns, an observer detached this way may still receive the notification in flight.
+    // While a BatchScope is alive notifications only mark their tag dirty, each dirty tag is sent once on scope exit.
+    // InstrumentationT times each OnNotification call when its IsEnabled is true, NoInstrumentation compiles it out.
+    // Coroutines awaiting Next(tag) and calls passed to CallAfterNotification run once the outermost notification
+    // returns.
+    template<typename SubjectT, IsTagEnum TagT, template<typename> typename StorageT = SetObserverStorage,
+        template<typename, typename> typename InstrumentationT = NoInstrumentation>
+        requires IsObserverStorage<StorageT<Observer<SubjectT, TagT>>, Observer<SubjectT, TagT>>
+    class Subject
+    {
+    public:
+        using Observer = Observer<SubjectT, TagT>;
+        using Tag = TagT;
+        using TagSet = TagSet<TagT>;
+        using Instrumentation = InstrumentationT<Observer, TagT>;
+
+        Subject() = default;
+
+        // The observer storages, handles and deferred mutations allocate from the resource, which must outlive the
+        // subject. Requires a storage constructible from a polymorphic_allocator, e.g. PmrSetObserverStorage.
+        explicit Subject(std::pmr::memory_resource* const resource)
+            requires std::constructible_from<StorageT<Observer>, std::pmr::polymorphic_allocator<Observer*>>
+            : m_Observers{MakeObserverStorages(resource, std::make_index_sequence<TagCount<TagT>>{})}
+            , m_Handles{resource}
+            , m_PendingMutations{resource}
+            , m_PendingCalls{resource}
+        {
+        }
+
+        class BatchScope
+        {
+        public:
+            explicit BatchScope(Subject& subject)
+                : m_Subject{subject}
+            {
+                ++m_Subject.m_BatchDepth;
+            }
+
+            ~BatchScope()
+            {
+                if(--m_Subject.m_BatchDepth == 0)
+                {
+                    m_Subject.SendBatchedNotifications();
+                }
+            }
+
+            BatchScope(const BatchScope&) = delete;
+            BatchScope& operator=(const BatchScope&) = delete;
+        private:
+            Subject& m_Subject;
+        };
+
+        // Awaiter of Next, a one-shot observer stored in the awaiting coroutine's frame. It detaches itself when notified
+        // and the coroutine is scheduled after every other observer of the notification was notified, so the coroutine
+        // may send notifications, await again or finish. Destroying a suspended coroutine detaches it, or cancels its
+        // resume when it was already notified, e.g. by a later observer of the same notification.
+        // The subject and executor must outlive the suspended coroutine.
+        template<IsCoroutineExecutor ExecutorT>
+        class NextNotification final : public Observer
+        {
+        public:
+            NextNotification(Subject& subject, const Tag tag, ExecutorT& executor)
+                : m_Subject{subject}
+                , m_Executor{executor}
+                , m_Tag{tag}
+            {
+            }
+
+            ~NextNotification() override
+            {
+                switch(m_State)
+                {
+                case State::Attached:
+                    m_Subject.DetachObserver(this, m_Tag);
+                    break;
+                case State::ResumePending:
+                    m_Subject.CancelCallAfterNotification(&Resume, this);
+                    break;
+                case State::Idle:
+                    break;
+                }
+            }
+
+            NextNotification(const NextNotification&) = delete;
+            NextNotification& operator=(const NextNotification&) = delete;
+
+            bool await_ready() const { return false; }
+
+            void await_suspend(const std::coroutine_handle<> handle)
+            {
+                m_Handle = handle;
+                m_Subject.AttachObserver(this, m_Tag);
+                m_State = State::Attached;
+            }
+
+            void await_resume() const {}
+
+            bool OnNotification(const SubjectT&, const Tag) override
+            {
+                if(m_State != State::Attached)
+                {
+                    return false;
+                }
+
+                m_State = State::ResumePending;
+                m_Subject.DetachObserver(this, m_Tag);
+                m_Subject.CallAfterNotification(&Resume, this);
+                return true;
+            }
+        private:
+            enum class State
+            {
+                Idle,
+                Attached,
+                ResumePending
+            };
+
+            // The executor may resume inline and destroy the awaiter with the coroutine frame.
+            static void Resume(void* const awaiter)
+            {
+                NextNotification& next{*static_cast<NextNotification*>(awaiter)};
+                next.m_State = State::Idle;
+                next.m_Executor.Schedule(next.m_Handle);
+            }
+
+            Subject& m_Subject;
+            ExecutorT& m_Executor;
+            std::coroutine_handle<> m_Handle{};
+            Tag m_Tag{};
+            State m_State{State::Idle};
+        };
+
+        // co_await subject.Next(tag) suspends until the next notification of tag, resumed on the notifying thread.
+        NextNotification<InlineExecutor> Next(const Tag tag)
+        {
+            return NextNotification<InlineExecutor>{*this, tag, s_InlineExecutor};
+        }
+
+        // Resumes through executor.Schedule(handle) instead.
+        template<IsCoroutineExecutor ExecutorT>
+        NextNotification<ExecutorT> Next(const Tag tag, ExecutorT& executor)
+        {
+            return NextNotification<ExecutorT>{*this, tag, executor};
+        }
+
+        // Calls call(context) once the outermost notification in progress returned and the deferred Attach/Detach were
+        // applied, or immediately when no notification is in progress. Calls may notify and defer further calls.
+        void CallAfterNotification(void(* const call)(void*), void* const context)
+        {
+            AssertNotNotifyingInParallel();
+            if(m_NotificationDepth == 0)
+            {
+                call(context);
+                return;
+            }
+
+            m_PendingCalls.push_back(PendingCall{call, context});
+        }
+
+        // Drops the calls of call(context) that did not run yet, for a context destroyed before its call ran.
+        void CancelCallAfterNotification(void(* const call)(void*), const void* const context)
+        {
+            const auto cancel{
+                [call, context](std::pmr::vector<PendingCall>& calls)
+                {
+                    for(PendingCall& pendingCall : calls)
+                    {
+                        if(pendingCall.m_Call == call && pendingCall.m_Context == context)
+                        {
+                            pendingCall.m_Call = nullptr;
+                        }
+                    }
+                }};
+            cancel(m_PendingCalls);
+            for(RunningCalls* running{m_RunningCalls}; running != nullptr; running = running->m_Outer)
+            {
+                cancel(running->m_Calls);
+            }
+        }
+
+        template<std::derived_from<Observer> ObserverT>
+        ObserverHandle AttachObserver(ObserverT* const observer)
+        {
+            return AttachObserver(observer, TagSet::All());
+        }
+
+        // Attaching an already attached observer returns its existing handle.
+        // The observer's static type decides whether it satisfies IsThreadSafeObserver for parallel notifications.
+        template<std::derived_from<Observer> ObserverT>
+        ObserverHandle AttachObserver(ObserverT* const observer, const TagSet tags)
+        {
+            return AttachObserverWithPriority(observer, tags, DefaultObserverPriority);
+        }
+
+        // Higher priorities are notified first. Tags the observer is already attached to keep their priority.
+        template<std::derived_from<Observer> ObserverT>
+        ObserverHandle AttachObserver(ObserverT* const observer, const TagSet tags, const int32_t priority)
+            requires IsPriorityObserverStorage<StorageT<Observer>, Observer>
+        {
+            return AttachObserverWithPriority(observer, tags, priority);
+        }
+
+        void DetachObserver(Observer* const observer)
+        {
+            DetachObserver(observer, TagSet::All());
+        }
+
+        void DetachObserver(Observer* const observer, const TagSet tags)
+        {
+            AssertNotNotifyingInParallel();
+            DetachObserver(m_Handles.Find(observer), tags);
+        }
+
+        // Returns false for a stale handle.
+        bool DetachObserver(const ObserverHandle handle)
+        {
+            return DetachObserver(handle, TagSet::All());
+        }
+
+        bool DetachObserver(const ObserverHandle handle, const TagSet tags)
+        {
+            AssertNotNotifyingInParallel();
+            if(!m_Handles.IsValid(handle))
+            {
+                return false;
+            }
+
+            Observer* const observer{m_Handles.GetObserver(handle)};
+            const bool isThreadSafe{m_Handles.IsThreadSafe(handle)};
+            TagSet& attachedTags{m_Handles.GetTags(handle)};
+            (tags & attachedTags).ForEach(
+                [this, observer, isThreadSafe](const Tag tag)
+                {
+                    EraseObserver(tag, observer);
+                    m_ThreadUnsafeCounts[static_cast<size_t>(tag)] -= isThreadSafe ? 0 : 1;
+                });
+
+            attachedTags = attachedTags & ~tags;
+            if(attachedTags.Empty())
+            {
+                ReleaseHandle(handle);
+            }
+
+            return true;
+        }
+
+        bool IsAttached(const ObserverHandle handle) const
+        {
+            return m_Handles.IsValid(handle);
+        }
+
+        Instrumentation& GetInstrumentation() { return m_Instrumentation; }
+        const Instrumentation& GetInstrumentation() const { return m_Instrumentation; }
+    protected:
+        void SendNotification(const Tag tag)
+        {
+            if(m_BatchDepth != 0)
+            {
+                m_DirtyTags.Insert(tag);
+                return;
+            }
+
+            const NotificationScope scope{*this};
+            GetObservers(tag).ForEach(
+                [this, tag](auto* const observer)
+                {
+                    NotifyObserver(observer, tag);
+                });
+        }
+
+        // Folds every OnNotification result with the reducer and returns its result, without allocating.
+        // Sent immediately even inside a BatchScope, since the caller needs the result.
+        template<IsNotificationReducer ReducerT>
+        auto SendNotification(const Tag tag, ReducerT reducer)
+        {
+            const NotificationScope scope{*this};
+            GetObservers(tag).ForEachWhile(
+                [this, tag, &reducer](auto* const observer)
+                {
+                    return reducer.Reduce(NotifyObserver(observer, tag));
+                });
+
+            return reducer.GetResult();
+        }
+
+        // Pushes the payload to the tag's observers, see PayloadObserver. Inside a BatchScope the payload is dropped and
+        // the tag is sent once on scope exit without it, so observers pull the latest state instead.
+        template<Tag TagV>
+            requires HasTagPayload<TagV>
+        void SendNotification(const TagPayloadT<TagV>& payload)
+        {
+            if(m_BatchDepth != 0)
+            {
+                m_DirtyTags.Insert(TagV);
+                return;
+            }
+
+            const NotificationScope scope{*this};
+            GetObservers(TagV).ForEach(
+                [this, &payload](auto* const observer)
+                {
+                    NotifyObserver(observer, TagV, &payload);
+                });
+        }
+
+        // Sets the property and pushes the old and new values to its tag's observers, setting an equal value sends nothing.
+        // Returns true if the value changed.
+        template<typename T, Tag TagV>
+        bool SetProperty(Property<T, TagV>& property, T value)
+        {
+            const std::optional<PropertyChange<T>> change{property.Exchange(std::move(value))};
+            if(!change.has_value())
+            {
+                return false;
+            }
+
+            SendNotification<TagV>(*change);
+            return true;
+        }
+
+        // Splits the tag's observers into chunks dispatched on the pool, returns once every observer was notified.
+        // Falls back to SendNotification if an observer attached to the tag is not an IsThreadSafeObserver, when
+        // called from inside another notification, or when instrumented since timings are recorded on one thread.
+        // Observers must not Attach/Detach during a parallel notification, debug builds assert it.
+        void SendNotificationParallel(WorkStealingThreadPool& pool, const Tag tag, const size_t chunkSize = 4096)
+            requires IsContiguousObserverStorage<StorageT<Observer>, Observer>
+        {
+            if(Instrumentation::IsEnabled || m_BatchDepth != 0 || m_NotificationDepth != 0
+                || m_ThreadUnsafeCounts[static_cast<size_t>(tag)] != 0)
+            {
+                SendNotification(tag);
+                return;
+            }
+
+            const NotificationScope scope{*this};
+            const ParallelNotificationScope parallelScope{*this};
+            const std::span<Observer* const> observers{GetObservers(tag).GetSpan()};
+            pool.ParallelFor(observers.size(), chunkSize,
+                [this, tag, observers](const size_t begin, const size_t end)
+                {
+                    for(Observer* const observer : observers.subspan(begin, end - begin))
+                    {
+                        observer->OnNotification(static_cast<const SubjectT&>(*this), tag);
+                    }
+                });
+        }
+    private:
+        class NotificationScope
+        {
+        public:
+            explicit NotificationScope(Subject& subject)
+                : m_Subject{subject}
+            {
+                ++m_Subject.m_NotificationDepth;
+            }
+
+            ~NotificationScope()
+            {
+                if(--m_Subject.m_NotificationDepth == 0)
+                {
+                    if(!m_Subject.m_PendingMutations.empty())
+                    {
+                        m_Subject.ApplyPendingMutations();
+                    }
+
+                    if(!m_Subject.m_PendingCalls.empty())
+                    {
+                        m_Subject.RunPendingCalls();
+                    }
+                }
+            }
+
+            NotificationScope(const NotificationScope&) = delete;
+            NotificationScope& operator=(const NotificationScope&) = delete;
+        private:
+            Subject& m_Subject;
+        };
+
+        // Clears the parallel flag even when an observer throws, ParallelFor rethrows once every thread has finished.
+        class ParallelNotificationScope
+        {
+        public:
+            explicit ParallelNotificationScope(Subject& subject)
+                : m_Subject{subject}
+            {
+                m_Subject.m_IsNotifyingInParallel = true;
+            }
+
+            ~ParallelNotificationScope()
+            {
+                m_Subject.m_IsNotifyingInParallel = false;
+            }
+
+            ParallelNotificationScope(const ParallelNotificationScope&) = delete;
+            ParallelNotificationScope& operator=(const ParallelNotificationScope&) = delete;
+        private:
+            Subject& m_Subject;
+        };
+
+        // Attach/Detach from a pool thread would race on the storage, handles and deferred mutations. The flag is only
+        // written by the notifying thread outside ParallelFor, so pool threads read it without a data race.
+        void AssertNotNotifyingInParallel() const
+        {
+            assert(!m_IsNotifyingInParallel && "Attach/Detach during a parallel notification");
+        }
+
+        template<typename ObserverT>
+        ObserverHandle AttachObserverWithPriority(ObserverT* const observer, const TagSet tags, const int32_t priority)
+        {
+            AssertNotNotifyingInParallel();
+            const ObserverHandle handle{m_Handles.Acquire(observer, IsThreadSafeObserver<ObserverT>)};
+            const bool isThreadSafe{m_Handles.IsThreadSafe(handle)};
+            TagSet& attachedTags{m_Handles.GetTags(handle)};
+            (tags & ~attachedTags).ForEach(
+                [this, observer, priority, isThreadSafe](const Tag tag)
+                {
+                    InsertObserver(tag, observer, priority);
+                    m_ThreadUnsafeCounts[static_cast<size_t>(tag)] += isThreadSafe ? 0 : 1;
+                });
+
+            attachedTags = attachedTags | tags;
+            if(attachedTags.Empty())
+            {
+                ReleaseHandle(handle);
+                return ObserverHandle{};
+            }
+
+            return handle;
+        }
+
+        void ReleaseHandle(const ObserverHandle handle)
+        {
+            m_Handles.Release(handle);
+            if constexpr(Instrumentation::IsEnabled)
+            {
+                m_Instrumentation.Release(handle);
+            }
+        }
+
+        template<typename ObserverT>
+        bool NotifyObserver(ObserverT* const observer, const Tag tag)
+        {
+            return TimeNotification(observer, tag,
+                [this, observer, tag]
+                {
+                    return observer->OnNotification(static_cast<const SubjectT&>(*this), tag);
+                });
+        }
+
+        template<typename ObserverT>
+        bool NotifyObserver(ObserverT* const observer, const Tag tag, const void* const payload)
+        {
+            return TimeNotification(observer, tag,
+                [this, observer, tag, payload]
+                {
+                    return observer->OnPayloadNotification(static_cast<const SubjectT&>(*this), tag, payload);
+                });
+        }
+
+        template<typename ObserverT, typename NotifyT>
+        bool TimeNotification(ObserverT* const observer, const Tag tag, NotifyT&& notify)
+        {
+            if constexpr(Instrumentation::IsEnabled)
+            {
+                const std::chrono::steady_clock::time_point start{std::chrono::steady_clock::now()};
+                const bool isHandled{notify()};
+                const std::chrono::nanoseconds duration{std::chrono::steady_clock::now() - start};
+                m_Instrumentation.Record(m_Handles.Find(observer), observer, tag, duration);
+                return isHandled;
+            }
+            else
+            {
+                return notify();
+            }
+        }
+
+        struct PendingMutation
+        {
+            Observer* m_Observer{nullptr};
+            Tag m_Tag{};
+            int32_t m_Priority{DefaultObserverPriority};
+            bool m_IsAttach{false};
+        };
+
+        void InsertObserver(const Tag tag, Observer* const observer, const int32_t priority)
+        {
+            if(m_NotificationDepth != 0)
+            {
+                m_PendingMutations.push_back(PendingMutation{observer, tag, priority, true});
+                return;
+            }
+
+            InsertIntoStorage(tag, observer, priority);
+        }
+
+        void EraseObserver(const Tag tag, Observer* const observer)
+        {
+            if(m_NotificationDepth != 0)
+            {
+                m_PendingMutations.push_back(PendingMutation{observer, tag, DefaultObserverPriority, false});
+                return;
+            }
+
+            GetObservers(tag).Erase(observer);
+        }
+
+        void InsertIntoStorage(const Tag tag, Observer* const observer, const int32_t priority)
+        {
+            if constexpr(IsPriorityObserverStorage<StorageT<Observer>, Observer>)
+            {
+                GetObservers(tag).Insert(observer, priority);
+            }
+            else
+            {
+                GetObservers(tag).Insert(observer);
+            }
+        }
+
+        void SendBatchedNotifications()
+        {
+            std::exchange(m_DirtyTags, TagSet{}).ForEach(
+                [this](const Tag tag)
+                {
+                    SendNotification(tag);
+                });
+        }
+
+        void ApplyPendingMutations()
+        {
+            for(const PendingMutation& mutation : m_PendingMutations)
+            {
+                if(mutation.m_IsAttach)
+                {
+                    InsertIntoStorage(mutation.m_Tag, mutation.m_Observer, mutation.m_Priority);
+                }
+                else
+                {
+                    GetObservers(mutation.m_Tag).Erase(mutation.m_Observer);
+                }
+            }
+
+            m_PendingMutations.clear();
+        }
+
+        struct PendingCall
+        {
+            void(*m_Call)(void*);
+            void* m_Context;
+        };
+
+        // Calls being run, chained so a call cancelled from a nested notification's calls is found. A cancelled call
+        // has a null m_Call.
+        struct RunningCalls
+        {
+            std::pmr::vector<PendingCall> m_Calls;
+            RunningCalls* m_Outer;
+        };
+
+        // Calls deferred by a notification sent from a call run their own notification's pending calls.
+        void RunPendingCalls()
+        {
+            RunningCalls running{std::pmr::vector<PendingCall>{m_PendingCalls.get_allocator()}, m_RunningCalls};
+            running.m_Calls.swap(m_PendingCalls);
+            m_RunningCalls = &running;
+            for(const PendingCall& call : running.m_Calls)
+            {
+                if(call.m_Call != nullptr)
+                {
+                    call.m_Call(call.m_Context);
+                }
+            }
+
+            m_RunningCalls = running.m_Outer;
+        }
+
+        template<size_t... IndicesT>
+        static std::array<StorageT<Observer>, TagCount<TagT>> MakeObserverStorages(
+            std::pmr::memory_resource* const resource, std::index_sequence<IndicesT...>)
+        {
+            return {((void)IndicesT, StorageT<Observer>{std::pmr::polymorphic_allocator<Observer*>{resource}})...};
+        }
+
+        StorageT<Observer>& GetObservers(const Tag tag) { return m_Observers[static_cast<size_t>(tag)]; }
+        const StorageT<Observer>& GetObservers(const Tag tag) const { return m_Observers[static_cast<size_t>(tag)]; }
+
+        static inline InlineExecutor s_InlineExecutor{};
+
+        std::array<StorageT<Observer>, TagCount<TagT>> m_Observers{};
+        ObserverSlotMap<Observer, TagT> m_Handles{};
+        std::pmr::vector<PendingMutation> m_PendingMutations{};
+        std::pmr::vector<PendingCall> m_PendingCalls{};
+        RunningCalls* m_RunningCalls{nullptr};
+        std::array<uint32_t, TagCount<TagT>> m_ThreadUnsafeCounts{};
+        TagSet m_DirtyTags{};
+        uint32_t m_NotificationDepth{0};
+        uint32_t m_BatchDepth{0};
+        bool m_IsNotifyingInParallel{false};
+        OBSERVER_NO_UNIQUE_ADDRESS Instrumentation m_Instrumentation{};
+    };
+
+    enum class SubjectSystemTag
+    {
+        ValueA,
+        ValueB,
+        Count
+    };
+
+    template<>
+    struct TagPayload<SubjectSystemTag::ValueA>
+    {
+        using Type = int32_t;
+    };
+
+    template<>
+    struct TagPayload<SubjectSystemTag::ValueB>
+    {
+        using Type = int32_t;
+    };
+
+    template<template<typename> typename StorageT,
+        template<typename, typename> typename InstrumentationT = NoInstrumentation>
+    class BasicSubjectSystem final
+        : public Subject<BasicSubjectSystem<StorageT, InstrumentationT>, SubjectSystemTag, StorageT, InstrumentationT>
+    {
+    public:
+        using Subject<BasicSubjectSystem<StorageT, InstrumentationT>, SubjectSystemTag, StorageT, InstrumentationT>::Subject;
+
+        void SetValueA(const int32_t value)
+        {
+            m_ValueA = value;
+            this->SendNotification(SubjectSystemTag::ValueA);
+        }
+
+        void SetValueB(const int32_t value)
+        {
+            m_ValueB = value;
+            this->SendNotification(SubjectSystemTag::ValueB);
+        }
+
+        void SetValueA(const int32_t value, WorkStealingThreadPool& pool)
+        {
+            m_ValueA = value;
+            this->SendNotificationParallel(pool, SubjectSystemTag::ValueA);
+        }
+
+        void SetValueB(const int32_t value, WorkStealingThreadPool& pool)
+        {
+            m_ValueB = value;
+            this->SendNotificationParallel(pool, SubjectSystemTag::ValueB);
+        }
+
+        template<IsNotificationReducer ReducerT>
+        auto SetValueA(const int32_t value, ReducerT reducer)
+        {
+            m_ValueA = value;
+            return this->SendNotification(SubjectSystemTag::ValueA, std::move(reducer));
+        }
+
+        template<IsNotificationReducer ReducerT>
+        auto SetValueB(const int32_t value, ReducerT reducer)
+        {
+            m_ValueB = value;
+            return this->SendNotification(SubjectSystemTag::ValueB, std::move(reducer));
+        }
+
+        // Sends the new value with the notification, see PayloadObserver.
+        void PushValueA(const int32_t value)
+        {
+            m_ValueA = value;
+            this->template SendNotification<SubjectSystemTag::ValueA>(value);
+        }
+
+        void PushValueB(const int32_t value)
+        {
+            m_ValueB = value;
+            this->template SendNotification<SubjectSystemTag::ValueB>(value);
+        }
+
+        int32_t GetValueA() const{ return m_ValueA; }
+        int32_t GetValueB() const { return m_ValueB; }
+    private:
+        int32_t m_ValueA{0};
+        int32_t m_ValueB{0};
+    };
+
+    using SubjectSystem = BasicSubjectSystem<SetObserverStorage>;
+    using VectorSubjectSystem = BasicSubjectSystem<VectorObserverStorage>;
+    using PrioritySubjectSystem = BasicSubjectSystem<PriorityObserverStorage>;
+    using PmrSubjectSystem = BasicSubjectSystem<PmrSetObserverStorage>;
+    using PmrVectorSubjectSystem = BasicSubjectSystem<PmrVectorObserverStorage>;
+    using InstrumentedSubjectSystem = BasicSubjectSystem<VectorObserverStorage, LatencyInstrumentation>;
+
+    template<typename SubjectSystemT>
+    class BasicSubjectObserverA final : public SubjectSystemT::Observer
+    {
+    public:
+        static constexpr bool IsThreadSafe{true};
+
+        bool OnNotification(const SubjectSystemT& subject, const typename SubjectSystemT::Tag tag) override
+        {
+            if(tag == SubjectSystemT::Tag::ValueA)
+            {
+                m_Value = subject.GetValueA();
+                return true;
+            }
+
+            return false;
+        }
+
+        int32_t GetValue() const { return m_Value; }
+    private:
+        int32_t m_Value{0};
+    };
+
+    template<typename SubjectSystemT>
+    class BasicSubjectObserverB final : public SubjectSystemT::Observer
+    {
+    public:
+        static constexpr bool IsThreadSafe{true};
+
+        bool OnNotification(const SubjectSystemT& subject, const typename SubjectSystemT::Tag tag) override
+        {
+            if(tag == SubjectSystemT::Tag::ValueB)
+            {
+                m_Value = subject.GetValueB();
+                return true;
+            }
+
+            return false;
+        }
+
+        int32_t GetValue() const { return m_Value; }
+    private:
+        int32_t m_Value{0};
+    };
+
+    template<typename SubjectSystemT>
+    class ThrowingSubjectObserver final : public SubjectSystemT::Observer
+    {
+    public:
+        static constexpr bool IsThreadSafe{true};
+
+        bool OnNotification(const SubjectSystemT&, const typename SubjectSystemT::Tag) override
+        {
+            throw std::runtime_error{"Observer failed"};
+        }
+    };
+
+    template<typename SubjectSystemT>
+    class BasicPayloadObserverA final
+        : public PayloadObserver<BasicPayloadObserverA<SubjectSystemT>, SubjectSystemT, typename SubjectSystemT::Tag>
+    {
+    public:
+        bool OnNotification(const SubjectSystemT& subject, const typename SubjectSystemT::Tag tag) override
+        {
+            if(tag == SubjectSystemT::Tag::ValueA)
+            {
+                m_Value = subject.GetValueA();
+                return true;
+            }
+
+            return false;
+        }
+
+        bool OnPayload(const SubjectSystemT&, TagConstant<SubjectSystemT::Tag::ValueA>, const int32_t value)
+        {
+            m_Value = value;
+            ++m_PayloadCount;
+            return true;
+        }
+
+        int32_t GetValue() const { return m_Value; }
+        uint32_t GetPayloadCount() const { return m_PayloadCount; }
+    private:
+        int32_t m_Value{0};
+        uint32_t m_PayloadCount{0};
+    };
+
+    enum class PropertySubjectSystemTag
+    {
+        ValueA,
+        ValueB,
+        Count
+    };
+
+    template<>
+    struct TagPayload<PropertySubjectSystemTag::ValueA>
+    {
+        using Type = PropertyChange<int32_t>;
+    };
+
+    template<>
+    struct TagPayload<PropertySubjectSystemTag::ValueB>
+    {
+        using Type = PropertyChange<int32_t>;
+    };
+
+    class PropertySubjectSystem final
+        : public Subject<PropertySubjectSystem, PropertySubjectSystemTag, VectorObserverStorage>
+    {
+    public:
+        bool SetValueA(const int32_t value) { return SetProperty(m_ValueA, value); }
+        bool SetValueB(const int32_t value) { return SetProperty(m_ValueB, value); }
+
+        int32_t GetValueA() const { return m_ValueA.Get(); }
+        int32_t GetValueB() const { return m_ValueB.Get(); }
+    private:
+        Property<int32_t, PropertySubjectSystemTag::ValueA> m_ValueA{};
+        Property<int32_t, PropertySubjectSystemTag::ValueB> m_ValueB{};
+    };
+
+    class PropertySubjectObserverA final
+        : public PayloadObserver<PropertySubjectObserverA, PropertySubjectSystem, PropertySubjectSystemTag>
+    {
+    public:
+        bool OnNotification(const PropertySubjectSystem& subject, const PropertySubjectSystemTag tag) override
+        {
+            if(tag == PropertySubjectSystemTag::ValueA)
+            {
+                m_Value = subject.GetValueA();
+                return true;
+            }
+
+            return false;
+        }
+
+        bool OnPayload(const PropertySubjectSystem&, TagConstant<PropertySubjectSystemTag::ValueA>,
+            const PropertyChange<int32_t>& change)
+        {
+            m_Delta += change.m_NewValue - change.m_OldValue;
+            m_Value = change.m_NewValue;
+            ++m_ChangeCount;
+            return true;
+        }
+
+        int32_t GetValue() const { return m_Value; }
+        int32_t GetDelta() const { return m_Delta; }
+        uint32_t GetChangeCount() const { return m_ChangeCount; }
+    private:
+        int32_t m_Value{0};
+        int32_t m_Delta{0};
+        uint32_t m_ChangeCount{0};
+    };
+
+    using SubjectObserverA = BasicSubjectObserverA<SubjectSystem>;
+    using SubjectObserverB = BasicSubjectObserverB<SubjectSystem>;
+
+    using TypeGroupedSubjectSystem = BasicSubjectSystem<TypeGroupedObserverStorage>;
+
+    template<>
+    struct ObserverTypeGroups<Observer<TypeGroupedSubjectSystem, SubjectSystemTag>>
+    {
+        using Types = std::tuple<
+            BasicSubjectObserverA<TypeGroupedSubjectSystem>,
+            BasicSubjectObserverB<TypeGroupedSubjectSystem>>;
+    };
+
+    TEST_CASE("Observer - Reference Semantics - Unit Tests")
+    {
+        SubjectSystem subject{};
+        SubjectObserverA observerA{};
+        SubjectObserverB observerB{};
+        SubjectObserverB observerBB{};
+        REQUIRE(subject.GetValueA() == 0);
+        REQUIRE(subject.GetValueB() == 0);
+        REQUIRE(observerA.GetValue() == 0);
+        REQUIRE(observerB.GetValue() == 0);
+        REQUIRE(observerBB.GetValue() == 0);
+
+        REQUIRE(observerA.OnNotification(subject, SubjectSystemTag::ValueA));
+        REQUIRE_FALSE(observerA.OnNotification(subject, SubjectSystemTag::ValueB));
+        REQUIRE(observerB.OnNotification(subject, SubjectSystemTag::ValueB));
+        REQUIRE_FALSE(observerB.OnNotification(subject, SubjectSystemTag::ValueA));
+        REQUIRE(observerBB.OnNotification(subject, SubjectSystemTag::ValueB));
+        REQUIRE_FALSE(observerBB.OnNotification(subject, SubjectSystemTag::ValueA));
+
+        REQUIRE(subject.GetValueA() == 0);
+        REQUIRE(subject.GetValueB() == 0);
+        REQUIRE(observerA.GetValue() == 0);
+        REQUIRE(observerB.GetValue() == 0);
+        REQUIRE(observerBB.GetValue() == 0);
+
+        subject.AttachObserver(&observerA);
+        subject.AttachObserver(&observerB);
+        subject.AttachObserver(&observerBB);
+
+        subject.SetValueA(1);
+
+        REQUIRE(subject.GetValueA() == 1);
+        REQUIRE(subject.GetValueB() == 0);
+        REQUIRE(observerA.GetValue() == 1);
+        REQUIRE(observerB.GetValue() == 0);
+        REQUIRE(observerBB.GetValue() == 0);
+
+        subject.SetValueB(2);
+
+        REQUIRE(subject.GetValueA() == 1);
+        REQUIRE(subject.GetValueB() == 2);
+        REQUIRE(observerA.GetValue() == 1);
+        REQUIRE(observerB.GetValue() == 2);
+        REQUIRE(observerBB.GetValue() == 2);
+
+        subject.DetachObserver(&observerBB);
+        subject.SetValueB(3);
+
+        REQUIRE(subject.GetValueA() == 1);
+        REQUIRE(subject.GetValueB() == 3);
+        REQUIRE(observerA.GetValue() == 1);
+        REQUIRE(observerB.GetValue() == 3);
+        REQUIRE(observerBB.GetValue() == 2);
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Per Tag Subscription Unit Tests")
+    {
+        class NotificationCounter final : public SubjectSystem::Observer
+        {
+        public:
+            bool OnNotification(const SubjectSystem&, const SubjectSystem::Tag) override
+            {
+                ++m_Count;
+                return true;
+            }
+
+            uint32_t GetCount() const { return m_Count; }
+        private:
+            uint32_t m_Count{0};
+        };
+
+        SubjectSystem subject{};
+        SubjectObserverA observerA{};
+        SubjectObserverB observerB{};
+        NotificationCounter counterA{};
+        NotificationCounter counterAB{};
+
+        subject.AttachObserver(&observerA, SubjectSystemTag::ValueA);
+        subject.AttachObserver(&observerB, SubjectSystemTag::ValueB);
+        subject.AttachObserver(&counterA, SubjectSystemTag::ValueA);
+        subject.AttachObserver(&counterAB, {SubjectSystemTag::ValueA, SubjectSystemTag::ValueB});
+
+        subject.SetValueA(1);
+
+        REQUIRE(observerA.GetValue() == 1);
+        REQUIRE(observerB.GetValue() == 0);
+        REQUIRE(counterA.GetCount() == 1);
+        REQUIRE(counterAB.GetCount() == 1);
+
+        subject.SetValueB(2);
+
+        REQUIRE(observerA.GetValue() == 1);
+        REQUIRE(observerB.GetValue() == 2);
+        REQUIRE(counterA.GetCount() == 1);
+        REQUIRE(counterAB.GetCount() == 2);
+
+        subject.AttachObserver(&counterA, SubjectSystemTag::ValueA);
+        subject.DetachObserver(&counterAB, SubjectSystemTag::ValueA);
+        subject.SetValueA(3);
+        subject.SetValueB(4);
+
+        REQUIRE(counterA.GetCount() == 2);
+        REQUIRE(counterAB.GetCount() == 3);
+
+        subject.DetachObserver(&counterA);
+        subject.DetachObserver(&counterAB);
+        subject.SetValueA(5);
+        subject.SetValueB(6);
+
+        REQUIRE(observerA.GetValue() == 5);
+        REQUIRE(observerB.GetValue() == 6);
+        REQUIRE(counterA.GetCount() == 2);
+        REQUIRE(counterAB.GetCount() == 3);
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Observer Handle Unit Tests")
+    {
+        SubjectSystem subject{};
+        SubjectObserverA observerA{};
+        SubjectObserverB observerB{};
+
+        const ObserverHandle handleA{subject.AttachObserver(&observerA)};
+        const ObserverHandle handleB{subject.AttachObserver(&observerB, SubjectSystemTag::ValueB)};
+        REQUIRE(handleA.IsValid());
+        REQUIRE(handleB.IsValid());
+        REQUIRE(handleA != handleB);
+        REQUIRE(subject.AttachObserver(&observerA) == handleA);
+        REQUIRE(subject.AttachObserver(&observerB, SubjectSystemTag::ValueA) == handleB);
+        REQUIRE_FALSE(ObserverHandle{}.IsValid());
+        REQUIRE_FALSE(subject.IsAttached(ObserverHandle{}));
+
+        subject.SetValueA(1);
+        subject.SetValueB(2);
+
+        REQUIRE(observerA.GetValue() == 1);
+        REQUIRE(observerB.GetValue() == 2);
+
+        REQUIRE(subject.DetachObserver(handleA));
+        REQUIRE_FALSE(subject.IsAttached(handleA));
+        REQUIRE_FALSE(subject.DetachObserver(handleA));
+
+        subject.SetValueA(3);
+
+        REQUIRE(observerA.GetValue() == 1);
+
+        // The released slot is reused with a new generation, the stale handle must not detach the new observer.
+        const ObserverHandle reattachedA{subject.AttachObserver(&observerA)};
+        REQUIRE(reattachedA.GetIndex() == handleA.GetIndex());
+        REQUIRE(reattachedA.GetGeneration() != handleA.GetGeneration());
+        REQUIRE_FALSE(subject.DetachObserver(handleA));
+        REQUIRE(subject.IsAttached(reattachedA));
+
+        subject.SetValueA(4);
+
+        REQUIRE(observerA.GetValue() == 4);
+
+        REQUIRE(subject.DetachObserver(handleB, SubjectSystemTag::ValueB));
+        REQUIRE(subject.IsAttached(handleB));
+        subject.SetValueB(5);
+
+        REQUIRE(observerB.GetValue() == 2);
+
+        subject.DetachObserver(&observerB, SubjectSystemTag::ValueA);
+        REQUIRE_FALSE(subject.IsAttached(handleB));
+        REQUIRE_FALSE(subject.AttachObserver(&observerB, {}).IsValid());
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Attach/Detach During Notification Unit Tests")
+    {
+        class OneShotObserver final : public SubjectSystem::Observer
+        {
+        public:
+            explicit OneShotObserver(SubjectSystem& subject)
+                : m_Subject{subject}
+            {
+            }
+
+            bool OnNotification(const SubjectSystem&, const SubjectSystem::Tag) override
+            {
+                ++m_Count;
+                m_Subject.DetachObserver(this);
+                return true;
+            }
+
+            uint32_t GetCount() const { return m_Count; }
+        private:
+            SubjectSystem& m_Subject;
+            uint32_t m_Count{0};
+        };
+
+        class AttachingObserver final : public SubjectSystem::Observer
+        {
+        public:
+            AttachingObserver(SubjectSystem& subject, SubjectSystem::Observer& attach, SubjectSystem::Observer& detach)
+                : m_Subject{subject}
+                , m_Attach{attach}
+                , m_Detach{detach}
+            {
+            }
+
+            bool OnNotification(const SubjectSystem&, const SubjectSystem::Tag tag) override
+            {
+                if(tag == SubjectSystem::Tag::ValueA)
+                {
+                    m_Subject.AttachObserver(&m_Attach);
+                    m_Subject.DetachObserver(&m_Detach);
+                    m_Subject.SetValueB(m_Subject.GetValueA());
+                }
+
+                return true;
+            }
+        private:
+            SubjectSystem& m_Subject;
+            SubjectSystem::Observer& m_Attach;
+            SubjectSystem::Observer& m_Detach;
+        };
+
+        SubjectSystem subject{};
+        std::vector<std::unique_ptr<OneShotObserver>> oneShots{};
+        for(uint32_t i{0}; i != 16; ++i)
+        {
+            oneShots.push_back(std::make_unique<OneShotObserver>(subject));
+            subject.AttachObserver(oneShots.back().get());
+        }
+
+        subject.SetValueA(1);
+        subject.SetValueA(2);
+
+        for(const std::unique_ptr<OneShotObserver>& oneShot : oneShots)
+        {
+            REQUIRE(oneShot->GetCount() == 1);
+        }
+
+        SubjectObserverA attached{};
+        SubjectObserverB detached{};
+        AttachingObserver attaching{subject, attached, detached};
+        subject.AttachObserver(&detached);
+        subject.AttachObserver(&attaching, SubjectSystemTag::ValueA);
+
+        // The nested SetValueB notification is sent while the outer notification is in flight,
+        // the mutations are only applied once both have returned.
+        subject.SetValueA(3);
+
+        REQUIRE(attached.GetValue() == 0);
+        REQUIRE(detached.GetValue() == 3);
+
+        subject.DetachObserver(&attaching);
+        subject.SetValueA(4);
+        subject.SetValueB(5);
+
+        REQUIRE(attached.GetValue() == 4);
+        REQUIRE(detached.GetValue() == 3);
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Parallel Notification Unit Tests")
+    {
+        class ThreadRecorder final : public VectorSubjectSystem::Observer
+        {
+        public:
+            bool OnNotification(const VectorSubjectSystem&, const VectorSubjectSystem::Tag) override
+            {
+                m_ThreadIds.push_back(std::this_thread::get_id());
+                return true;
+            }
+
+            const std::vector<std::thread::id>& GetThreadIds() const { return m_ThreadIds; }
+        private:
+            std::vector<std::thread::id> m_ThreadIds{};
+        };
+
+        STATIC_REQUIRE(IsThreadSafeObserver<BasicSubjectObserverA<VectorSubjectSystem>>);
+        STATIC_REQUIRE_FALSE(IsThreadSafeObserver<ThreadRecorder>);
+
+        WorkStealingThreadPool pool{4};
+        VectorSubjectSystem subject{};
+        std::vector<std::unique_ptr<BasicSubjectObserverA<VectorSubjectSystem>>> observersA{};
+        for(uint32_t i{0}; i != 10'000; ++i)
+        {
+            observersA.push_back(std::make_unique<BasicSubjectObserverA<VectorSubjectSystem>>());
+            subject.AttachObserver(observersA.back().get());
+        }
+
+        subject.SetValueA(1, pool);
+
+        REQUIRE(std::all_of(observersA.begin(), observersA.end(),
+            [](const std::unique_ptr<BasicSubjectObserverA<VectorSubjectSystem>>& observer){ return observer->GetValue() == 1; }));
+
+        ThreadRecorder recorder{};
+        subject.AttachObserver(&recorder, SubjectSystemTag::ValueA);
+        subject.SetValueA(2, pool);
+        subject.SetValueA(3, pool);
+
+        REQUIRE(std::all_of(observersA.begin(), observersA.end(),
+            [](const std::unique_ptr<BasicSubjectObserverA<VectorSubjectSystem>>& observer){ return observer->GetValue() == 3; }));
+        REQUIRE(recorder.GetThreadIds() == std::vector<std::thread::id>{std::this_thread::get_id(), std::this_thread::get_id()});
+
+        subject.DetachObserver(&recorder);
+        subject.SetValueA(4, pool);
+
+        REQUIRE(std::all_of(observersA.begin(), observersA.end(),
+            [](const std::unique_ptr<BasicSubjectObserverA<VectorSubjectSystem>>& observer){ return observer->GetValue() == 4; }));
+        REQUIRE(recorder.GetThreadIds().size() == 2);
+
+        // The exception reaches the caller once every chunk finished and the subject accepts Attach/Detach again.
+        ThrowingSubjectObserver<VectorSubjectSystem> throwing{};
+        subject.AttachObserver(&throwing, SubjectSystemTag::ValueA);
+
+        REQUIRE_THROWS_AS(subject.SetValueA(5, pool), std::runtime_error);
+
+        subject.DetachObserver(&throwing);
+        subject.SetValueA(6, pool);
+
+        REQUIRE(std::all_of(observersA.begin(), observersA.end(),
+            [](const std::unique_ptr<BasicSubjectObserverA<VectorSubjectSystem>>& observer){ return observer->GetValue() == 6; }));
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Batch Scope Unit Tests")
+    {
+        class NotificationCounter final : public SubjectSystem::Observer
+        {
+        public:
+            bool OnNotification(const SubjectSystem&, const SubjectSystem::Tag tag) override
+            {
+                ++m_Counts[static_cast<size_t>(tag)];
+                return true;
+            }
+
+            uint32_t GetCount(const SubjectSystem::Tag tag) const { return m_Counts[static_cast<size_t>(tag)]; }
+        private:
+            std::array<uint32_t, TagCount<SubjectSystemTag>> m_Counts{};
+        };
+
+        SubjectSystem subject{};
+        SubjectObserverA observerA{};
+        SubjectObserverB observerB{};
+        NotificationCounter counter{};
+        subject.AttachObserver(&observerA);
+        subject.AttachObserver(&observerB);
+        subject.AttachObserver(&counter);
+
+        {
+            const SubjectSystem::BatchScope batch{subject};
+            for(int32_t i{1}; i <= 10; ++i)
+            {
+                subject.SetValueA(i);
+                subject.SetValueB(i * 2);
+            }
+
+            {
+                const SubjectSystem::BatchScope nestedBatch{subject};
+                subject.SetValueA(11);
+            }
+
+            REQUIRE(observerA.GetValue() == 0);
+            REQUIRE(observerB.GetValue() == 0);
+            REQUIRE(counter.GetCount(SubjectSystemTag::ValueA) == 0);
+            REQUIRE(counter.GetCount(SubjectSystemTag::ValueB) == 0);
+        }
+
+        REQUIRE(observerA.GetValue() == 11);
+        REQUIRE(observerB.GetValue() == 20);
+        REQUIRE(counter.GetCount(SubjectSystemTag::ValueA) == 1);
+        REQUIRE(counter.GetCount(SubjectSystemTag::ValueB) == 1);
+
+        {
+            const SubjectSystem::BatchScope batch{subject};
+            subject.SetValueB(21);
+        }
+
+        REQUIRE(observerB.GetValue() == 21);
+        REQUIRE(counter.GetCount(SubjectSystemTag::ValueA) == 1);
+        REQUIRE(counter.GetCount(SubjectSystemTag::ValueB) == 2);
+
+        subject.SetValueA(12);
+
+        REQUIRE(observerA.GetValue() == 12);
+        REQUIRE(counter.GetCount(SubjectSystemTag::ValueA) == 2);
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Notification Reducer Unit Tests")
+    {
+        class CountingObserver final : public VectorSubjectSystem::Observer
+        {
+        public:
+            explicit CountingObserver(const bool isHandled)
+                : m_IsHandled{isHandled}
+            {
+            }
+
+            bool OnNotification(const VectorSubjectSystem&, const VectorSubjectSystem::Tag) override
+            {
+                ++m_Count;
+                return m_IsHandled;
+            }
+
+            uint32_t GetCount() const { return m_Count; }
+        private:
+            bool m_IsHandled{false};
+            uint32_t m_Count{0};
+        };
+
+        VectorSubjectSystem subject{};
+
+        REQUIRE_FALSE(subject.SetValueA(0, AnyHandledReducer{}));
+        REQUIRE(subject.SetValueA(0, AllHandledReducer{}));
+        REQUIRE(subject.SetValueA(0, CountHandledReducer{}) == 0);
+        REQUIRE_FALSE(subject.SetValueA(0, FirstHandledReducer{}));
+
+        CountingObserver unhandled{false};
+        CountingObserver handled{true};
+        CountingObserver last{true};
+        subject.AttachObserver(&unhandled);
+        subject.AttachObserver(&handled);
+        subject.AttachObserver(&last);
+
+        REQUIRE(subject.SetValueA(1, AnyHandledReducer{}));
+        REQUIRE_FALSE(subject.SetValueA(2, AllHandledReducer{}));
+        REQUIRE(subject.SetValueA(3, CountHandledReducer{}) == 2);
+        REQUIRE(unhandled.GetCount() == 3);
+        REQUIRE(last.GetCount() == 3);
+
+        REQUIRE(subject.SetValueA(4, FirstHandledReducer{}));
+        REQUIRE(unhandled.GetCount() == 4);
+        REQUIRE(handled.GetCount() == 4);
+        REQUIRE(last.GetCount() == 3);
+
+        const FoldReducer unhandledCount{uint32_t{0},
+            [](const uint32_t count, const bool isHandled){ return count + (isHandled ? 0 : 1); }};
+        REQUIRE(subject.SetValueB(5, unhandledCount) == 1);
+        REQUIRE(subject.GetValueB() == 5);
+
+        subject.DetachObserver(&handled);
+
+        REQUIRE(subject.SetValueA(6, FirstHandledReducer{}));
+        REQUIRE(last.GetCount() == 5);
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Priority Storage Unit Tests")
+    {
+        class RecordingObserver final : public PrioritySubjectSystem::Observer
+        {
+        public:
+            RecordingObserver(std::vector<int32_t>& log, const int32_t id, const bool isHandled)
+                : m_Log{log}
+                , m_Id{id}
+                , m_IsHandled{isHandled}
+            {
+            }
+
+            bool OnNotification(const PrioritySubjectSystem&, const PrioritySubjectSystem::Tag) override
+            {
+                m_Log.push_back(m_Id);
+                return m_IsHandled;
+            }
+        private:
+            std::vector<int32_t>& m_Log;
+            int32_t m_Id{0};
+            bool m_IsHandled{false};
+        };
+
+        class AttachingObserver final : public PrioritySubjectSystem::Observer
+        {
+        public:
+            AttachingObserver(PrioritySubjectSystem& subject, PrioritySubjectSystem::Observer& attach)
+                : m_Subject{subject}
+                , m_Attach{attach}
+            {
+            }
+
+            bool OnNotification(const PrioritySubjectSystem&, const PrioritySubjectSystem::Tag) override
+            {
+                m_Subject.AttachObserver(&m_Attach, PrioritySubjectSystem::TagSet::All(), 20);
+                return false;
+            }
+        private:
+            PrioritySubjectSystem& m_Subject;
+            PrioritySubjectSystem::Observer& m_Attach;
+        };
+
+        std::vector<int32_t> log{};
+        PrioritySubjectSystem subject{};
+        RecordingObserver observer0{log, 0, false};
+        RecordingObserver observer1{log, 1, true};
+        RecordingObserver observer2{log, 2, false};
+        RecordingObserver observer3{log, 3, false};
+        RecordingObserver observer4{log, 4, false};
+        subject.AttachObserver(&observer0);
+        subject.AttachObserver(&observer1, PrioritySubjectSystem::TagSet::All(), 10);
+        subject.AttachObserver(&observer2, PrioritySubjectSystem::TagSet::All(), -5);
+        subject.AttachObserver(&observer3, PrioritySubjectSystem::TagSet::All(), 10);
+        subject.AttachObserver(&observer3, PrioritySubjectSystem::TagSet::All(), -10);
+
+        subject.SetValueA(0);
+
+        REQUIRE(log == std::vector<int32_t>{1, 3, 0, 2});
+
+        log.clear();
+
+        REQUIRE(subject.SetValueA(0, FirstHandledReducer{}));
+        REQUIRE(log == std::vector<int32_t>{1});
+
+        log.clear();
+        subject.DetachObserver(&observer1);
+
+        REQUIRE_FALSE(subject.SetValueA(0, FirstHandledReducer{}));
+        REQUIRE(log == std::vector<int32_t>{3, 0, 2});
+
+        AttachingObserver attaching{subject, observer4};
+        subject.AttachObserver(&attaching);
+        log.clear();
+        subject.SetValueB(0);
+
+        REQUIRE(log == std::vector<int32_t>{3, 0, 2});
+
+        log.clear();
+        subject.SetValueB(0);
+
+        REQUIRE(log == std::vector<int32_t>{4, 3, 0, 2});
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Memory Resource Unit Tests")
+    {
+        class CountingResource final : public std::pmr::memory_resource
+        {
+        public:
+            uint32_t GetAllocationCount() const { return m_AllocationCount; }
+        private:
+            void* do_allocate(const size_t bytes, const size_t alignment) override
+            {
+                ++m_AllocationCount;
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void* const pointer, const size_t bytes, const size_t alignment) override
+            {
+                std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+            {
+                return this == &other;
+            }
+
+            uint32_t m_AllocationCount{0};
+        };
+
+        SECTION("Set Storage")
+        {
+            CountingResource resource{};
+            PmrSubjectSystem subject{&resource};
+            BasicSubjectObserverA<PmrSubjectSystem> observerA{};
+            BasicSubjectObserverB<PmrSubjectSystem> observerB{};
+            subject.AttachObserver(&observerA);
+
+            const uint32_t allocationCount{resource.GetAllocationCount()};
+
+            REQUIRE(allocationCount != 0);
+
+            subject.AttachObserver(&observerB);
+
+            REQUIRE(resource.GetAllocationCount() > allocationCount);
+
+            subject.SetValueA(1);
+            subject.SetValueB(2);
+
+            REQUIRE(observerA.GetValue() == 1);
+            REQUIRE(observerB.GetValue() == 2);
+        }
+
+        SECTION("Monotonic Arena")
+        {
+            std::array<std::byte, 16 * 1024> buffer{};
+            std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(), std::pmr::null_memory_resource()};
+            PmrVectorSubjectSystem subject{&arena};
+            std::array<BasicSubjectObserverA<PmrVectorSubjectSystem>, 32> observers{};
+            for(BasicSubjectObserverA<PmrVectorSubjectSystem>& observer : observers)
+            {
+                subject.AttachObserver(&observer);
+            }
+
+            subject.SetValueA(1);
+
+            REQUIRE(std::all_of(observers.begin(), observers.end(),
+                [](const BasicSubjectObserverA<PmrVectorSubjectSystem>& observer){ return observer.GetValue() == 1; }));
+
+            subject.DetachObserver(&observers.front());
+            subject.SetValueA(2);
+
+            REQUIRE(observers.front().GetValue() == 1);
+            REQUIRE(observers.back().GetValue() == 2);
+        }
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Latency Instrumentation Unit Tests")
+    {
+        SECTION("Histogram")
+        {
+            LatencyHistogram histogram{};
+
+            REQUIRE(histogram.GetPercentile(50.0) == std::chrono::nanoseconds{0});
+
+            for(int64_t i{1}; i <= 1'000; ++i)
+            {
+                histogram.Record(std::chrono::nanoseconds{i});
+            }
+
+            REQUIRE(histogram.GetCount() == 1'000);
+            REQUIRE(histogram.GetMax() == std::chrono::nanoseconds{1'000});
+            REQUIRE(histogram.GetPercentile(0.0) == std::chrono::nanoseconds{1});
+            REQUIRE(histogram.GetPercentile(50.0).count() >= 500);
+            REQUIRE(histogram.GetPercentile(50.0).count() <= 500 + 500 / 8);
+            REQUIRE(histogram.GetPercentile(99.0).count() >= 990);
+            REQUIRE(histogram.GetPercentile(100.0) == std::chrono::nanoseconds{1'000});
+
+            histogram.Record(std::chrono::seconds{5});
+
+            REQUIRE(histogram.GetMax() == std::chrono::seconds{5});
+            REQUIRE(histogram.GetPercentile(100.0) == std::chrono::seconds{5});
+        }
+
+        SECTION("Slow Observer")
+        {
+            class SlowObserver final : public InstrumentedSubjectSystem::Observer
+            {
+            public:
+                bool OnNotification(const InstrumentedSubjectSystem&, const InstrumentedSubjectSystem::Tag) override
+                {
+                    const std::chrono::steady_clock::time_point end{
+                        std::chrono::steady_clock::now() + std::chrono::milliseconds{2}};
+                    while(std::chrono::steady_clock::now() < end)
+                    {
+                    }
+
+                    return true;
+                }
+            };
+
+            InstrumentedSubjectSystem subject{};
+            BasicSubjectObserverA<InstrumentedSubjectSystem> observerA{};
+            SlowObserver slowObserver{};
+            const ObserverHandle handleA{subject.AttachObserver(&observerA)};
+            const ObserverHandle slowHandle{subject.AttachObserver(&slowObserver, SubjectSystemTag::ValueA)};
+            subject.GetInstrumentation().SetSlowThreshold(std::chrono::milliseconds{1});
+
+            for(int32_t i{0}; i != 5; ++i)
+            {
+                subject.SetValueA(i);
+            }
+
+            subject.SetValueB(0);
+
+            const InstrumentedSubjectSystem::Instrumentation& instrumentation{subject.GetInstrumentation()};
+            REQUIRE(instrumentation.GetObserverHistogram(handleA)->GetCount() == 6);
+            REQUIRE(instrumentation.GetObserverHistogram(slowHandle)->GetCount() == 5);
+            REQUIRE(instrumentation.GetObserverHistogram(slowHandle)->GetPercentile(50.0)
+                >= std::chrono::milliseconds{2} - std::chrono::milliseconds{2} / 8);
+            REQUIRE(instrumentation.GetObserverHistogram(slowHandle)->GetMax() >= std::chrono::milliseconds{2});
+            REQUIRE(instrumentation.GetTagHistogram(SubjectSystemTag::ValueA).GetCount() == 10);
+            REQUIRE(instrumentation.GetTagHistogram(SubjectSystemTag::ValueB).GetCount() == 1);
+            REQUIRE(instrumentation.GetSlowObservers()
+                == std::vector<std::pair<const InstrumentedSubjectSystem::Observer*, uint64_t>>{{&slowObserver, 5}});
+
+            subject.GetInstrumentation().Reset();
+
+            REQUIRE(instrumentation.GetObserverHistogram(handleA) == nullptr);
+            REQUIRE(instrumentation.GetSlowObservers().empty());
+        }
+
+        SECTION("Detach Drops Observer Statistics")
+        {
+            InstrumentedSubjectSystem subject{};
+            BasicSubjectObserverA<InstrumentedSubjectSystem> observerA{};
+            const ObserverHandle handle{subject.AttachObserver(&observerA)};
+            subject.SetValueA(1);
+
+            REQUIRE(subject.GetInstrumentation().GetObserverHistogram(handle)->GetCount() == 1);
+
+            // The observer attached again reuses the slot, it must not inherit the statistics of the detached one.
+            subject.DetachObserver(handle);
+            const ObserverHandle reattachedHandle{subject.AttachObserver(&observerA)};
+
+            REQUIRE(reattachedHandle.GetIndex() == handle.GetIndex());
+            REQUIRE(subject.GetInstrumentation().GetObserverHistogram(handle) == nullptr);
+            REQUIRE(subject.GetInstrumentation().GetObserverHistogram(reattachedHandle) == nullptr);
+
+            subject.SetValueA(2);
+
+            REQUIRE(subject.GetInstrumentation().GetObserverHistogram(handle) == nullptr);
+            REQUIRE(subject.GetInstrumentation().GetObserverHistogram(reattachedHandle)->GetCount() == 1);
+            REQUIRE(subject.GetInstrumentation().GetTagHistogram(SubjectSystemTag::ValueA).GetCount() == 2);
+        }
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Payload Notification Unit Tests")
+    {
+        SECTION("Push")
+        {
+            VectorSubjectSystem subject{};
+            BasicPayloadObserverA<VectorSubjectSystem> payloadObserver{};
+            BasicSubjectObserverA<VectorSubjectSystem> observerA{};
+            BasicSubjectObserverB<VectorSubjectSystem> observerB{};
+            subject.AttachObserver(&payloadObserver);
+            subject.AttachObserver(&observerA);
+            subject.AttachObserver(&observerB);
+            subject.PushValueA(1);
+
+            REQUIRE(payloadObserver.GetValue() == 1);
+            REQUIRE(payloadObserver.GetPayloadCount() == 1);
+            REQUIRE(observerA.GetValue() == 1);
+
+            subject.PushValueB(2);
+
+            REQUIRE(payloadObserver.GetPayloadCount() == 1);
+            REQUIRE(observerB.GetValue() == 2);
+
+            subject.SetValueA(3);
+
+            REQUIRE(payloadObserver.GetValue() == 3);
+            REQUIRE(payloadObserver.GetPayloadCount() == 1);
+        }
+
+        SECTION("Batch Scope")
+        {
+            VectorSubjectSystem subject{};
+            BasicPayloadObserverA<VectorSubjectSystem> payloadObserver{};
+            subject.AttachObserver(&payloadObserver);
+            {
+                const VectorSubjectSystem::BatchScope batch{subject};
+                subject.PushValueA(1);
+                subject.PushValueA(2);
+
+                REQUIRE(payloadObserver.GetValue() == 0);
+            }
+
+            REQUIRE(payloadObserver.GetValue() == 2);
+            REQUIRE(payloadObserver.GetPayloadCount() == 0);
+        }
+
+        SECTION("Type Grouped Storage")
+        {
+            TypeGroupedSubjectSystem subject{};
+            BasicPayloadObserverA<TypeGroupedSubjectSystem> payloadObserver{};
+            BasicSubjectObserverA<TypeGroupedSubjectSystem> observerA{};
+            subject.AttachObserver(&payloadObserver);
+            subject.AttachObserver(&observerA);
+            subject.PushValueA(1);
+
+            REQUIRE(payloadObserver.GetPayloadCount() == 1);
+            REQUIRE(observerA.GetValue() == 1);
+        }
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Property Unit Tests")
+    {
+        PropertySubjectSystem subject{};
+        PropertySubjectObserverA observerA{};
+        BasicSubjectObserverB<PropertySubjectSystem> observerB{};
+        subject.AttachObserver(&observerA);
+        subject.AttachObserver(&observerB);
+
+        REQUIRE_FALSE(subject.SetValueA(0));
+        REQUIRE(observerA.GetChangeCount() == 0);
+
+        REQUIRE(subject.SetValueA(3));
+        REQUIRE_FALSE(subject.SetValueA(3));
+        REQUIRE(subject.SetValueA(5));
+
+        REQUIRE(subject.GetValueA() == 5);
+        REQUIRE(observerA.GetValue() == 5);
+        REQUIRE(observerA.GetDelta() == 5);
+        REQUIRE(observerA.GetChangeCount() == 2);
+
+        REQUIRE(subject.SetValueB(2));
+        REQUIRE_FALSE(subject.SetValueB(2));
+
+        REQUIRE(observerB.GetValue() == 2);
+        REQUIRE(observerA.GetChangeCount() == 2);
+
+        {
+            const PropertySubjectSystem::BatchScope batch{subject};
+            subject.SetValueA(6);
+            subject.SetValueA(7);
+        }
+
+        REQUIRE(observerA.GetValue() == 7);
+        REQUIRE(observerA.GetChangeCount() == 2);
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Next Notification Unit Tests")
+    {
+        // Starts eagerly, destroying the task destroys a suspended coroutine.
+        class Task
+        {
+        public:
+            struct promise_type
+            {
+                Task get_return_object() { return Task{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+                std::suspend_never initial_suspend() noexcept { return {}; }
+                std::suspend_always final_suspend() noexcept { return {}; }
+                void return_void() {}
+                void unhandled_exception() { std::terminate(); }
+            };
+
+            explicit Task(const std::coroutine_handle<promise_type> handle)
+                : m_Handle{handle}
+            {
+            }
+
+            Task(Task&& other) noexcept
+                : m_Handle{std::exchange(other.m_Handle, {})}
+            {
+            }
+
+            ~Task()
+            {
+                if(m_Handle)
+                {
+                    m_Handle.destroy();
+                }
+            }
+
+            Task(const Task&) = delete;
+            Task& operator=(const Task&) = delete;
+
+            bool IsDone() const { return m_Handle.done(); }
+        private:
+            std::coroutine_handle<promise_type> m_Handle;
+        };
+
+        class QueueExecutor
+        {
+        public:
+            void Schedule(const std::coroutine_handle<> handle) { m_Handles.push_back(handle); }
+
+            void Run()
+            {
+                for(const std::coroutine_handle<> handle : std::exchange(m_Handles, {}))
+                {
+                    handle.resume();
+                }
+            }
+        private:
+            std::vector<std::coroutine_handle<>> m_Handles{};
+        };
+
+        SECTION("Inline")
+        {
+            VectorSubjectSystem subject{};
+            BasicSubjectObserverA<VectorSubjectSystem> observerA{};
+            std::vector<int32_t> values{};
+            const Task task{
+                [](VectorSubjectSystem& subject, BasicSubjectObserverA<VectorSubjectSystem>& observerA,
+                    std::vector<int32_t>& values) -> Task
+                {
+                    co_await subject.Next(SubjectSystemTag::ValueA);
+                    values.push_back(observerA.GetValue());
+                    co_await subject.Next(SubjectSystemTag::ValueA);
+                    values.push_back(subject.GetValueA());
+                }(subject, observerA, values)};
+            subject.AttachObserver(&observerA);
+            subject.SetValueB(1);
+
+            REQUIRE(values.empty());
+
+            subject.SetValueA(2);
+
+            REQUIRE(values == std::vector<int32_t>{2});
+
+            subject.SetValueA(3);
+
+            REQUIRE(values == std::vector<int32_t>{2, 3});
+            REQUIRE(task.IsDone());
+
+            subject.SetValueA(4);
+
+            REQUIRE(values.size() == 2);
+        }
+
+        SECTION("Notify On Resume")
+        {
+            VectorSubjectSystem subject{};
+            BasicSubjectObserverA<VectorSubjectSystem> observerA{};
+            subject.AttachObserver(&observerA);
+            const Task task{
+                [](VectorSubjectSystem& subject) -> Task
+                {
+                    co_await subject.Next(SubjectSystemTag::ValueA);
+                    subject.SetValueA(subject.GetValueA() * 10);
+                }(subject)};
+            subject.SetValueA(2);
+
+            REQUIRE(task.IsDone());
+            REQUIRE(observerA.GetValue() == 20);
+        }
+
+        SECTION("Executor")
+        {
+            VectorSubjectSystem subject{};
+            QueueExecutor executor{};
+            uint32_t resumeCount{0};
+            const Task task{
+                [](VectorSubjectSystem& subject, QueueExecutor& executor, uint32_t& resumeCount) -> Task
+                {
+                    co_await subject.Next(SubjectSystemTag::ValueA, executor);
+                    ++resumeCount;
+                }(subject, executor, resumeCount)};
+            subject.SetValueA(1);
+            subject.SetValueA(2);
+
+            REQUIRE(resumeCount == 0);
+
+            executor.Run();
+
+            REQUIRE(resumeCount == 1);
+            REQUIRE(task.IsDone());
+        }
+
+        SECTION("Destroyed While Suspended")
+        {
+            VectorSubjectSystem subject{};
+            uint32_t resumeCount{0};
+            {
+                const Task task{
+                    [](VectorSubjectSystem& subject, uint32_t& resumeCount) -> Task
+                    {
+                        co_await subject.Next(SubjectSystemTag::ValueA);
+                        ++resumeCount;
+                    }(subject, resumeCount)};
+            }
+
+            subject.SetValueA(1);
+
+            REQUIRE(resumeCount == 0);
+        }
+
+        SECTION("Destroyed While Resume Pending")
+        {
+            // Notified after the awaiter of the same notification, destroys the task before its resume runs.
+            class TaskDestroyer final : public VectorSubjectSystem::Observer
+            {
+            public:
+                explicit TaskDestroyer(std::optional<Task>& task)
+                    : m_Task{task}
+                {
+                }
+
+                bool OnNotification(const VectorSubjectSystem&, const VectorSubjectSystem::Tag) override
+                {
+                    m_Task.reset();
+                    return true;
+                }
+            private:
+                std::optional<Task>& m_Task;
+            };
+
+            VectorSubjectSystem subject{};
+            uint32_t resumeCount{0};
+            std::optional<Task> task{};
+            task.emplace(
+                [](VectorSubjectSystem& subject, uint32_t& resumeCount) -> Task
+                {
+                    co_await subject.Next(SubjectSystemTag::ValueA);
+                    ++resumeCount;
+                }(subject, resumeCount));
+            TaskDestroyer destroyer{task};
+            subject.AttachObserver(&destroyer, SubjectSystemTag::ValueA);
+            subject.SetValueA(1);
+
+            REQUIRE_FALSE(task.has_value());
+            REQUIRE(resumeCount == 0);
+        }
+
+        SECTION("Destroyed By An Earlier Resume")
+        {
+            VectorSubjectSystem subject{};
+            uint32_t resumeCount{0};
+            std::optional<Task> task{};
+            const Task destroyingTask{
+                [](VectorSubjectSystem& subject, std::optional<Task>& task) -> Task
+                {
+                    co_await subject.Next(SubjectSystemTag::ValueA);
+                    task.reset();
+                }(subject, task)};
+            task.emplace(
+                [](VectorSubjectSystem& subject, uint32_t& resumeCount) -> Task
+                {
+                    co_await subject.Next(SubjectSystemTag::ValueA);
+                    ++resumeCount;
+                }(subject, resumeCount));
+            subject.SetValueA(1);
+
+            REQUIRE(destroyingTask.IsDone());
+            REQUIRE_FALSE(task.has_value());
+            REQUIRE(resumeCount == 0);
+        }
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Vector Storage Unit Tests")
+    {
+        SubjectObserverA observerA{};
+        SubjectObserverB observerB{};
+        SubjectObserverB observerBB{};
+
+        VectorObserverStorage<SubjectSystem::Observer> storage{};
+        REQUIRE(storage.Size() == 0);
+
+        REQUIRE(storage.Insert(&observerA));
+        REQUIRE(storage.Insert(&observerB));
+        REQUIRE(storage.Insert(&observerBB));
+        REQUIRE_FALSE(storage.Insert(&observerA));
+        REQUIRE(storage.Size() == 3);
+
+        REQUIRE(storage.Erase(&observerA));
+        REQUIRE_FALSE(storage.Erase(&observerA));
+        REQUIRE(storage.Size() == 2);
+
+        std::vector<SubjectSystem::Observer*> visited{};
+        storage.ForEach([&visited](SubjectSystem::Observer* const observer){ visited.push_back(observer); });
+        REQUIRE(visited == std::vector<SubjectSystem::Observer*>{&observerBB, &observerB});
+
+        REQUIRE(storage.Erase(&observerB));
+        REQUIRE(storage.Erase(&observerBB));
+        REQUIRE(storage.Size() == 0);
+        REQUIRE(storage.Insert(&observerA));
+        REQUIRE(storage.Size() == 1);
+
+        VectorSubjectSystem subject{};
+        BasicSubjectObserverA<VectorSubjectSystem> vectorObserverA{};
+        BasicSubjectObserverB<VectorSubjectSystem> vectorObserverB{};
+        subject.AttachObserver(&vectorObserverA);
+        subject.AttachObserver(&vectorObserverA);
+        subject.AttachObserver(&vectorObserverB);
+
+        subject.SetValueA(1);
+        subject.SetValueB(2);
+
+        REQUIRE(vectorObserverA.GetValue() == 1);
+        REQUIRE(vectorObserverB.GetValue() == 2);
+
+        subject.DetachObserver(&vectorObserverA);
+        subject.SetValueA(3);
+
+        REQUIRE(vectorObserverA.GetValue() == 1);
+        REQUIRE(vectorObserverB.GetValue() == 2);
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Type Grouped Storage Unit Tests")
+    {
+        class NotificationCounter final : public TypeGroupedSubjectSystem::Observer
+        {
+        public:
+            bool OnNotification(const TypeGroupedSubjectSystem&, const TypeGroupedSubjectSystem::Tag) override
+            {
+                ++m_Count;
+                return true;
+            }
+
+            uint32_t GetCount() const { return m_Count; }
+        private:
+            uint32_t m_Count{0};
+        };
+
+        BasicSubjectObserverA<TypeGroupedSubjectSystem> observerA{};
+        BasicSubjectObserverB<TypeGroupedSubjectSystem> observerB{};
+        BasicSubjectObserverA<TypeGroupedSubjectSystem> observerAA{};
+        NotificationCounter counter{};
+
+        TypeGroupedObserverStorage<TypeGroupedSubjectSystem::Observer> storage{};
+        REQUIRE(storage.Insert(&observerA));
+        REQUIRE(storage.Insert(&counter));
+        REQUIRE(storage.Insert(&observerB));
+        REQUIRE(storage.Insert(&observerAA));
+        REQUIRE_FALSE(storage.Insert(&observerA));
+        REQUIRE(storage.Size() == 4);
+
+        std::vector<TypeGroupedSubjectSystem::Observer*> visited{};
+        storage.ForEach([&visited](TypeGroupedSubjectSystem::Observer* const observer){ visited.push_back(observer); });
+        REQUIRE(visited == std::vector<TypeGroupedSubjectSystem::Observer*>{&observerA, &observerAA, &observerB, &counter});
+
+        REQUIRE(storage.Erase(&counter));
+        REQUIRE_FALSE(storage.Erase(&counter));
+        REQUIRE(storage.Erase(&observerA));
+        REQUIRE(storage.Size() == 2);
+
+        TypeGroupedSubjectSystem subject{};
+        subject.AttachObserver(&observerA);
+        subject.AttachObserver(&observerB);
+        subject.AttachObserver(&counter);
+
+        subject.SetValueA(1);
+        subject.SetValueB(2);
+
+        REQUIRE(observerA.GetValue() == 1);
+        REQUIRE(observerB.GetValue() == 2);
+        REQUIRE(observerAA.GetValue() == 0);
+        REQUIRE(counter.GetCount() == 2);
+
+        subject.DetachObserver(&observerA);
+        subject.DetachObserver(&counter);
+        subject.SetValueA(3);
+
+        REQUIRE(observerA.GetValue() == 1);
+        REQUIRE(counter.GetCount() == 2);
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Attach/Detach Benchmarks")
+    {
+        constexpr uint32_t creationCount{250'000};
+        std::vector<std::shared_ptr<SubjectSystem::Observer>> observers{};
+        std::vector<std::shared_ptr<VectorSubjectSystem::Observer>> vectorObservers{};
+        observers.reserve(creationCount + creationCount / 10);
+        vectorObservers.reserve(creationCount + creationCount / 10);
+        for(uint32_t i{0}; i != creationCount + creationCount / 10; ++i)
+        {
+            observers.push_back(std::make_shared<SubjectObserverA>());
+            vectorObservers.push_back(std::make_shared<BasicSubjectObserverA<VectorSubjectSystem>>());
+        }
+
+        Benchmarks::BenchmarkAttachDetach<SubjectSystem>("", observers, creationCount);
+        Benchmarks::BenchmarkAttachDetach<VectorSubjectSystem>(" - Vector Storage", vectorObservers, creationCount);
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Memory Resource Benchmarks")
+    {
+        constexpr uint32_t subjectCount{1'000};
+        constexpr uint32_t observerCount{64};
+        std::vector<std::unique_ptr<SubjectObserverA>> observers{};
+        std::vector<std::unique_ptr<BasicSubjectObserverA<PmrSubjectSystem>>> pmrObservers{};
+        for(uint32_t i{0}; i != observerCount; ++i)
+        {
+            observers.push_back(std::make_unique<SubjectObserverA>());
+            pmrObservers.push_back(std::make_unique<BasicSubjectObserverA<PmrSubjectSystem>>());
+        }
+
+        BENCHMARK("Benchmark Short-Lived Subjects")
+        {
+            for(uint32_t i{0}; i != subjectCount; ++i)
+            {
+                SubjectSystem subject{};
+                for(std::unique_ptr<SubjectObserverA>& observer : observers)
+                {
+                    subject.AttachObserver(observer.get());
+                }
+
+                subject.SetValueA(0);
+            }
+        };
+
+        std::vector<std::byte> buffer(1024 * 1024);
+        BENCHMARK("Benchmark Short-Lived Subjects - Monotonic Arena")
+        {
+            for(uint32_t i{0}; i != subjectCount; ++i)
+            {
+                std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size()};
+                PmrSubjectSystem subject{&arena};
+                for(std::unique_ptr<BasicSubjectObserverA<PmrSubjectSystem>>& observer : pmrObservers)
+                {
+                    subject.AttachObserver(observer.get());
+                }
+
+                subject.SetValueA(0);
+            }
+        };
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Benchmarks")
+    {
+        constexpr uint32_t creationCount{250'000};
+        SubjectSystem subject{};
+        std::vector<std::shared_ptr<SubjectSystem::Observer>> observers{};
+        observers.reserve(creationCount);
+        for(uint32_t i{0}; i != creationCount; ++i)
+        {
+            std::shared_ptr<SubjectSystem::Observer> observer{std::make_unique<SubjectObserverA>()};
+            observers.push_back(observer);
+            subject.AttachObserver(observer.get());
+        }
+
+        VectorSubjectSystem vectorSubject{};
+        std::vector<std::shared_ptr<VectorSubjectSystem::Observer>> vectorObservers{};
+        vectorObservers.reserve(creationCount);
+        for(uint32_t i{0}; i != creationCount; ++i)
+        {
+            std::shared_ptr<VectorSubjectSystem::Observer> observer{
+                std::make_unique<BasicSubjectObserverA<VectorSubjectSystem>>()};
+            vectorObservers.push_back(observer);
+            vectorSubject.AttachObserver(observer.get());
+        }
+
+        BENCHMARK("Benchmark Notification")
+        {
+            subject.SetValueA(0);
+        };
+
+        BENCHMARK("Benchmark Notification - Vector Storage")
+        {
+            vectorSubject.SetValueA(0);
+        };
+
+        SubjectSystem taggedSubject{};
+        for(std::shared_ptr<SubjectSystem::Observer>& observer : observers)
+        {
+            taggedSubject.AttachObserver(observer.get(), SubjectSystemTag::ValueA);
+        }
+
+        BENCHMARK("Benchmark Notification - Unhandled Tag")
+        {
+            subject.SetValueB(0);
+        };
+
+        BENCHMARK("Benchmark Notification - Unsubscribed Tag")
+        {
+            taggedSubject.SetValueB(0);
+        };
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Observer Handle Benchmarks")
+    {
+        VectorSubjectSystem subject{};
+        std::vector<ObserverHandle> handles{};
+        const Benchmarks::PooledObserverFactory<BasicSubjectObserverA<VectorSubjectSystem>> observers{
+            Benchmarks::CreateAttachedObservers<BasicSubjectObserverA<VectorSubjectSystem>>(
+                subject, Benchmarks::NotificationObserverCount,
+                [&handles](VectorSubjectSystem& attachSubject, VectorSubjectSystem::Observer* const observer, size_t)
+                {
+                    handles.push_back(attachSubject.AttachObserver(observer));
+                })};
+
+        BENCHMARK("Benchmark Churn - Vector Storage - Handle")
+        {
+            for(size_t i{0}; i < observers.Size(); i += 10)
+            {
+                subject.DetachObserver(handles[i]);
+                handles[i] = subject.AttachObserver(observers[i]);
+            }
+        };
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Batch Scope Benchmarks")
+    {
+        VectorSubjectSystem subject{};
+        const Benchmarks::PooledObserverFactory<BasicSubjectObserverA<VectorSubjectSystem>> observers{
+            Benchmarks::CreateAttachedObservers<BasicSubjectObserverA<VectorSubjectSystem>>(subject)};
+
+        BENCHMARK("Benchmark Notification - Vector Storage - 10x SetValueA/SetValueB")
+        {
+            for(int32_t i{0}; i != 10; ++i)
+            {
+                subject.SetValueA(i);
+                subject.SetValueB(i);
+            }
+        };
+
+        BENCHMARK("Benchmark Notification - Vector Storage - 10x SetValueA/SetValueB - Batch Scope")
+        {
+            const VectorSubjectSystem::BatchScope batch{subject};
+            for(int32_t i{0}; i != 10; ++i)
+            {
+                subject.SetValueA(i);
+                subject.SetValueB(i);
+            }
+        };
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Latency Instrumentation Benchmarks")
+    {
+        // Each observer keeps a histogram of under 1KB, so a realistic observer count is instrumented. The uninstrumented
+        // row uses the same count, the Vector Storage baseline of the Reference Semantics Benchmarks uses far more.
+        constexpr size_t observerCount{1'000};
+        VectorSubjectSystem subject{};
+        const Benchmarks::PooledObserverFactory<BasicSubjectObserverA<VectorSubjectSystem>> observers{
+            Benchmarks::CreateAttachedObservers<BasicSubjectObserverA<VectorSubjectSystem>>(subject, observerCount)};
+        InstrumentedSubjectSystem instrumentedSubject{};
+        const Benchmarks::PooledObserverFactory<BasicSubjectObserverA<InstrumentedSubjectSystem>> instrumentedObservers{
+            Benchmarks::CreateAttachedObservers<BasicSubjectObserverA<InstrumentedSubjectSystem>>(
+                instrumentedSubject, observerCount)};
+
+        BENCHMARK("Benchmark Notification - Vector Storage - 1000 Observers")
+        {
+            subject.SetValueA(0);
+        };
+
+        BENCHMARK("Benchmark Notification - Vector Storage - 1000 Observers - Latency Instrumentation")
+        {
+            instrumentedSubject.SetValueA(0);
+        };
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Notification Reducer Benchmarks")
+    {
+        VectorSubjectSystem subject{};
+        const Benchmarks::PooledObserverFactory<BasicSubjectObserverA<VectorSubjectSystem>> observers{
+            Benchmarks::CreateAttachedObservers<BasicSubjectObserverA<VectorSubjectSystem>>(subject)};
+
+        BENCHMARK("Benchmark Notification - Vector Storage - Any Handled Reducer")
+        {
+            return subject.SetValueA(0, AnyHandledReducer{});
+        };
+
+        BENCHMARK("Benchmark Notification - Vector Storage - First Handled Reducer")
+        {
+            return subject.SetValueA(0, FirstHandledReducer{});
+        };
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Priority Storage Benchmarks")
+    {
+        constexpr size_t observerCount{Benchmarks::NotificationObserverCount};
+        PrioritySubjectSystem prioritySubject{};
+        const Benchmarks::PooledObserverFactory<BasicSubjectObserverA<PrioritySubjectSystem>> priorityObservers{
+            Benchmarks::CreateAttachedObservers<BasicSubjectObserverA<PrioritySubjectSystem>>(
+                prioritySubject, observerCount,
+                [](PrioritySubjectSystem& subject, PrioritySubjectSystem::Observer* const observer, const size_t index)
+                {
+                    // Descending priorities so each attach appends instead of shifting the observers behind it.
+                    subject.AttachObserver(observer, PrioritySubjectSystem::TagSet::All(),
+                        static_cast<int32_t>(16 - index * 16 / observerCount));
+                })};
+
+        BENCHMARK("Benchmark Notification - Priority Storage")
+        {
+            prioritySubject.SetValueA(0);
+        };
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Payload Notification Benchmarks")
+    {
+        VectorSubjectSystem subject{};
+        const Benchmarks::PooledObserverFactory<BasicPayloadObserverA<VectorSubjectSystem>> observers{
+            Benchmarks::CreateAttachedObservers<BasicPayloadObserverA<VectorSubjectSystem>>(subject)};
+
+        BENCHMARK("Benchmark Notification - Vector Storage - Payload Observer - Pull")
+        {
+            subject.SetValueA(0);
+        };
+
+        BENCHMARK("Benchmark Notification - Vector Storage - Payload Observer - Push")
+        {
+            subject.PushValueA(0);
+        };
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Property Benchmarks")
+    {
+        // A plain subject notifies unchanged values too, its cost is "Benchmark Notification - Vector Storage".
+        PropertySubjectSystem propertySubject{};
+        const Benchmarks::PooledObserverFactory<PropertySubjectObserverA> propertyObservers{
+            Benchmarks::CreateAttachedObservers<PropertySubjectObserverA>(propertySubject)};
+
+        BENCHMARK("Benchmark Notification - Property - Unchanged Value")
+        {
+            return propertySubject.SetValueA(propertySubject.GetValueA());
+        };
+
+        BENCHMARK("Benchmark Notification - Property - Changed Value")
+        {
+            return propertySubject.SetValueA(propertySubject.GetValueA() + 1);
+        };
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Next Notification Benchmarks")
+    {
+        BENCHMARK_ADVANCED("Benchmark Next Notification - 1000 Coroutines")(Catch::Benchmark::Chronometer meter)
+        {
+            VectorSubjectSystem nextSubject{};
+            struct Task
+            {
+                struct promise_type
+                {
+                    Task get_return_object() { return {}; }
+                    std::suspend_never initial_suspend() noexcept { return {}; }
+                    std::suspend_never final_suspend() noexcept { return {}; }
+                    void return_void() {}
+                    void unhandled_exception() { std::terminate(); }
+                };
+            };
+
+            meter.measure(
+                [&nextSubject]
+                {
+                    for(uint32_t i{0}; i != 1'000; ++i)
+                    {
+                        [](VectorSubjectSystem& subject) -> Task
+                        {
+                            co_await subject.Next(SubjectSystemTag::ValueA);
+                        }(nextSubject);
+                    }
+
+                    nextSubject.SetValueA(0);
+                });
+        };
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Type Grouped Benchmarks")
+    {
+        constexpr uint32_t creationCount{250'000};
+        SubjectSystem subject{};
+        VectorSubjectSystem vectorSubject{};
+        TypeGroupedSubjectSystem groupedSubject{};
+        std::vector<std::shared_ptr<SubjectSystem::Observer>> observers{};
+        std::vector<std::shared_ptr<VectorSubjectSystem::Observer>> vectorObservers{};
+        std::vector<std::shared_ptr<TypeGroupedSubjectSystem::Observer>> groupedObservers{};
+        observers.reserve(creationCount);
+        vectorObservers.reserve(creationCount);
+        groupedObservers.reserve(creationCount);
+        for(uint32_t i{0}; i != creationCount; ++i)
+        {
+            if(i % 2 == 0)
+            {
+                observers.push_back(std::make_shared<SubjectObserverA>());
+                vectorObservers.push_back(std::make_shared<BasicSubjectObserverA<VectorSubjectSystem>>());
+                groupedObservers.push_back(std::make_shared<BasicSubjectObserverA<TypeGroupedSubjectSystem>>());
+            }
+            else
+            {
+                observers.push_back(std::make_shared<SubjectObserverB>());
+                vectorObservers.push_back(std::make_shared<BasicSubjectObserverB<VectorSubjectSystem>>());
+                groupedObservers.push_back(std::make_shared<BasicSubjectObserverB<TypeGroupedSubjectSystem>>());
+            }
+
+            subject.AttachObserver(observers.back().get());
+            vectorSubject.AttachObserver(vectorObservers.back().get());
+            groupedSubject.AttachObserver(groupedObservers.back().get());
+        }
+
+        BENCHMARK("Benchmark Notification - Interleaved")
+        {
+            subject.SetValueA(0);
+        };
+
+        BENCHMARK("Benchmark Notification - Interleaved - Vector Storage")
+        {
+            vectorSubject.SetValueA(0);
+        };
+
+        BENCHMARK("Benchmark Notification - Interleaved - Type Grouped Storage")
+        {
+            groupedSubject.SetValueA(0);
+        };
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Parallel Notification Benchmarks")
+    {
+        // The sequential baseline is "Benchmark Notification - Vector Storage" in the Reference Semantics Benchmarks.
+        VectorSubjectSystem subject{};
+        const Benchmarks::PooledObserverFactory<BasicSubjectObserverA<VectorSubjectSystem>> observers{
+            Benchmarks::CreateAttachedObservers<BasicSubjectObserverA<VectorSubjectSystem>>(subject)};
+
+        for(const uint32_t threadCount : {1u, 2u, 4u, 8u})
+        {
+            WorkStealingThreadPool pool{threadCount};
+            BENCHMARK("Benchmark Notification - Parallel - " + std::to_string(threadCount) + " Threads")
+            {
+                subject.SetValueA(0, pool);
+            };
+        }
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Observer Pool Benchmarks")
+    {
+        constexpr size_t creationCount{Benchmarks::NotificationObserverCount};
+        using ObserverA = BasicSubjectObserverA<VectorSubjectSystem>;
+
+        VectorSubjectSystem heapSubject{};
+        std::vector<std::unique_ptr<ObserverA>> heapObservers{};
+        heapObservers.reserve(creationCount);
+        for(size_t i{0}; i != creationCount; ++i)
+        {
+            heapObservers.push_back(std::make_unique<ObserverA>());
+            heapSubject.AttachObserver(heapObservers.back().get());
+        }
+
+        BENCHMARK("Benchmark Notification - Heap")
+        {
+            heapSubject.SetValueA(0);
+        };
+
+        // Unrelated allocations of varying size between observers, like observers created over a program's lifetime.
+        VectorSubjectSystem scatteredSubject{};
+        std::vector<std::unique_ptr<ObserverA>> scatteredObservers{};
+        std::vector<std::unique_ptr<std::byte[]>> padding{};
+        std::mt19937 random{42};
+        std::uniform_int_distribution<size_t> paddingSize{16, 512};
+        scatteredObservers.reserve(creationCount);
+        padding.reserve(creationCount);
+        for(size_t i{0}; i != creationCount; ++i)
+        {
+            padding.push_back(std::make_unique<std::byte[]>(paddingSize(random)));
+            scatteredObservers.push_back(std::make_unique<ObserverA>());
+            scatteredSubject.AttachObserver(scatteredObservers.back().get());
+        }
+
+        BENCHMARK("Benchmark Notification - Heap Scattered")
+        {
+            scatteredSubject.SetValueA(0);
+        };
+
+        // The allocation the other notification benchmarks use.
+        VectorSubjectSystem poolSubject{};
+        const Benchmarks::PooledObserverFactory<ObserverA> poolObservers{
+            Benchmarks::CreateAttachedObservers<ObserverA>(poolSubject, creationCount)};
+
+        BENCHMARK("Benchmark Notification - Observer Pool")
+        {
+            poolSubject.SetValueA(0);
         };
     }
 }
@@ -0,0 +1,332 @@
+#pragma once
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <memory>
+#include <array>
+#include <vector>
+#include <algorithm>
+
+#include "observerexamples_referencesemantics.h"
+
+namespace ReferenceSemantics
+{
+    // SendNotification only sets the tag's bit in the calling thread's shard, writers on different threads never touch
+    // the same cache line. Flush merges the shards' pending tags and notifies each tag once, on the flushing thread, so
+    // observers pull the latest state and several sends between flushes coalesce like in a BatchScope.
+    // Observers are kept in the shard of the thread attaching them, an observer must only be attached from one thread.
+    // Attach/Detach must not be called from inside OnNotification.
+    template<typename SubjectT, IsTagEnum TagT, size_t ShardCountT = 16>
+        requires (TagCount<TagT> <= 64)
+    class ShardedSubject
+    {
+    public:
+        using Observer = Observer<SubjectT, TagT>;
+        using Tag = TagT;
+        using TagSet = TagSet<TagT>;
+
+        ShardedSubject() = default;
+
+        ShardedSubject(const ShardedSubject&) = delete;
+        ShardedSubject& operator=(const ShardedSubject&) = delete;
+
+        void AttachObserver(Observer* const observer, const TagSet tags = TagSet::All())
+        {
+            Shard& shard{GetShard()};
+            const std::scoped_lock lock{shard.m_Mutex};
+            tags.ForEach(
+                [&shard, observer](const Tag tag)
+                {
+                    std::vector<Observer*>& observers{shard.m_Observers[static_cast<size_t>(tag)]};
+                    if(std::find(observers.begin(), observers.end(), observer) == observers.end())
+                    {
+                        observers.push_back(observer);
+                    }
+                });
+        }
+
+        // Searches every shard, the observer may have been attached from another thread.
+        void DetachObserver(Observer* const observer, const TagSet tags = TagSet::All())
+        {
+            for(Shard& shard : m_Shards)
+            {
+                const std::scoped_lock lock{shard.m_Mutex};
+                tags.ForEach(
+                    [&shard, observer](const Tag tag)
+                    {
+                        std::erase(shard.m_Observers[static_cast<size_t>(tag)], observer);
+                    });
+            }
+        }
+
+        // Notifies every tag sent since the last Flush once, returns the notified tags. Flushes are serialized.
+        TagSet Flush()
+        {
+            const std::scoped_lock flushLock{m_FlushMutex};
+            uint64_t pendingTags{0};
+            for(Shard& shard : m_Shards)
+            {
+                if(shard.m_PendingTags.load(std::memory_order_relaxed) != 0)
+                {
+                    pendingTags |= shard.m_PendingTags.exchange(0, std::memory_order_acquire);
+                }
+            }
+
+            TagSet tags{};
+            for(size_t i{0}; i != TagCount<TagT>; ++i)
+            {
+                if((pendingTags >> i & 1) != 0)
+                {
+                    tags.Insert(static_cast<Tag>(i));
+                }
+            }
+
+            tags.ForEach(
+                [this](const Tag tag)
+                {
+                    for(Shard& shard : m_Shards)
+                    {
+                        const std::scoped_lock lock{shard.m_Mutex};
+                        for(Observer* const observer : shard.m_Observers[static_cast<size_t>(tag)])
+                        {
+                            observer->OnNotification(static_cast<const SubjectT&>(*this), tag);
+                        }
+                    }
+                });
+
+            return tags;
+        }
+    protected:
+        static constexpr size_t ShardCount{ShardCountT};
+
+        // Index of the calling thread's shard, lets derived subjects keep their own state per shard.
+        static uint32_t GetShardIndex() { return t_ShardIndex; }
+
+        void SendNotification(const Tag tag)
+        {
+            // Always read-modify-write: skipping the write when the bit looks set could race with Flush clearing it and
+            // leave the change unnotified. The release pairs with Flush's acquire so observers see the new state.
+            GetShard().m_PendingTags.fetch_or(uint64_t{1} << static_cast<size_t>(tag), std::memory_order_release);
+        }
+    private:
+        // The pending tags get their own line, Flush locking m_Mutex does not take it away from the shard's writers.
+        struct alignas(CacheLineSize) Shard
+        {
+            alignas(CacheLineSize) std::atomic<uint64_t> m_PendingTags{0};
+            alignas(CacheLineSize) std::mutex m_Mutex{};
+            std::array<std::vector<Observer*>, TagCount<TagT>> m_Observers{};
+        };
+
+        Shard& GetShard() { return m_Shards[t_ShardIndex]; }
+
+        static inline std::atomic<uint32_t> s_NextShardIndex{0};
+        static inline thread_local const uint32_t t_ShardIndex{
+            static_cast<uint32_t>(s_NextShardIndex.fetch_add(1) % ShardCountT)};
+
+        std::array<Shard, ShardCountT> m_Shards{};
+        std::mutex m_FlushMutex{};
+    };
+
+    // Counters sharded like the pending tags, writers only add to their own shard and readers sum the shards.
+    class ShardedSubjectSystem final : public ShardedSubject<ShardedSubjectSystem, SubjectSystemTag>
+    {
+    public:
+        void AddValueA(const int32_t value)
+        {
+            m_Values[GetShardIndex()].m_ValueA.fetch_add(value, std::memory_order_relaxed);
+            SendNotification(SubjectSystemTag::ValueA);
+        }
+
+        void AddValueB(const int32_t value)
+        {
+            m_Values[GetShardIndex()].m_ValueB.fetch_add(value, std::memory_order_relaxed);
+            SendNotification(SubjectSystemTag::ValueB);
+        }
+
+        int32_t GetValueA() const { return SumValues(&ShardValues::m_ValueA); }
+        int32_t GetValueB() const { return SumValues(&ShardValues::m_ValueB); }
+    private:
+        struct alignas(CacheLineSize) ShardValues
+        {
+            std::atomic<int32_t> m_ValueA{0};
+            std::atomic<int32_t> m_ValueB{0};
+        };
+
+        int32_t SumValues(std::atomic<int32_t> ShardValues::* const value) const
+        {
+            int32_t sum{0};
+            for(const ShardValues& values : m_Values)
+            {
+                sum += (values.*value).load(std::memory_order_relaxed);
+            }
+
+            return sum;
+        }
+
+        std::array<ShardValues, ShardCount> m_Values{};
+    };
+
+    TEST_CASE("Observer - Reference Semantics - Sharded Subject Unit Tests")
+    {
+        SECTION("Flush")
+        {
+            ShardedSubjectSystem subject{};
+            BasicSubjectObserverA<ShardedSubjectSystem> observerA{};
+            BasicSubjectObserverB<ShardedSubjectSystem> observerB{};
+            subject.AttachObserver(&observerA, SubjectSystemTag::ValueA);
+            subject.AttachObserver(&observerB);
+            subject.AddValueA(1);
+            subject.AddValueA(1);
+
+            REQUIRE(observerA.GetValue() == 0);
+            REQUIRE(subject.Flush() == ShardedSubjectSystem::TagSet{SubjectSystemTag::ValueA});
+            REQUIRE(observerA.GetValue() == 2);
+            REQUIRE(subject.Flush().Empty());
+
+            subject.AddValueB(3);
+            subject.DetachObserver(&observerA);
+            subject.AddValueA(2);
+            subject.Flush();
+
+            REQUIRE(observerA.GetValue() == 2);
+            REQUIRE(observerB.GetValue() == 3);
+        }
+
+        SECTION("Concurrent Writers")
+        {
+            class CountingObserver final : public ShardedSubjectSystem::Observer
+            {
+            public:
+                bool OnNotification(const ShardedSubjectSystem&, const SubjectSystemTag tag) override
+                {
+                    ++m_Counts[static_cast<size_t>(tag)];
+                    return true;
+                }
+
+                uint32_t GetCount(const SubjectSystemTag tag) const { return m_Counts[static_cast<size_t>(tag)]; }
+            private:
+                std::array<uint32_t, TagCount<SubjectSystemTag>> m_Counts{};
+            };
+
+            ShardedSubjectSystem subject{};
+            std::array<CountingObserver, 4> observers{};
+            {
+                std::vector<std::jthread> threads{};
+                for(CountingObserver& observer : observers)
+                {
+                    threads.emplace_back(
+                        [&subject, &observer]
+                        {
+                            subject.AttachObserver(&observer);
+                            for(int32_t i{0}; i != 1'000; ++i)
+                            {
+                                subject.AddValueA(1);
+                            }
+                        });
+                }
+            }
+
+            subject.Flush();
+
+            REQUIRE(subject.GetValueA() == 4'000);
+            for(const CountingObserver& observer : observers)
+            {
+                REQUIRE(observer.GetCount(SubjectSystemTag::ValueA) == 1);
+                REQUIRE(observer.GetCount(SubjectSystemTag::ValueB) == 0);
+            }
+        }
+
+        SECTION("Interleaved Flush")
+        {
+            // Flushes race the writer, the last addition must still be notified by the flush following it.
+            constexpr int32_t writeCount{20'000};
+            ShardedSubjectSystem subject{};
+            BasicSubjectObserverA<ShardedSubjectSystem> observerA{};
+            subject.AttachObserver(&observerA);
+
+            std::atomic<bool> isWriting{true};
+            std::jthread writer{
+                [&subject, &isWriting]
+                {
+                    for(int32_t i{0}; i != writeCount; ++i)
+                    {
+                        subject.AddValueA(1);
+                    }
+
+                    isWriting.store(false);
+                }};
+
+            while(isWriting.load())
+            {
+                subject.Flush();
+            }
+
+            writer.join();
+            subject.Flush();
+
+            REQUIRE(observerA.GetValue() == writeCount);
+        }
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Sharded Subject Benchmarks")
+    {
+        constexpr uint32_t observerCount{1'000};
+        constexpr int32_t writesPerThread{10'000};
+        const uint32_t threadCount{std::clamp(std::thread::hardware_concurrency(), 2u, 8u)};
+
+        VectorSubjectSystem vectorSubject{};
+        std::vector<std::unique_ptr<BasicSubjectObserverA<VectorSubjectSystem>>> vectorObservers{};
+        ShardedSubjectSystem shardedSubject{};
+        std::vector<std::unique_ptr<BasicSubjectObserverA<ShardedSubjectSystem>>> shardedObservers{};
+        for(uint32_t i{0}; i != observerCount; ++i)
+        {
+            vectorObservers.push_back(std::make_unique<BasicSubjectObserverA<VectorSubjectSystem>>());
+            vectorSubject.AttachObserver(vectorObservers.back().get());
+            shardedObservers.push_back(std::make_unique<BasicSubjectObserverA<ShardedSubjectSystem>>());
+            shardedSubject.AttachObserver(shardedObservers.back().get());
+        }
+
+        // Both subjects count the same increments, the sharded counters keep each writer on its own cache lines.
+        std::mutex vectorSubjectMutex{};
+        BENCHMARK("Benchmark Concurrent Writes - Vector Storage - Mutex")
+        {
+            std::vector<std::jthread> threads{};
+            for(uint32_t i{0}; i != threadCount; ++i)
+            {
+                threads.emplace_back(
+                    [&vectorSubject, &vectorSubjectMutex]
+                    {
+                        for(int32_t i{0}; i != writesPerThread; ++i)
+                        {
+                            const std::scoped_lock lock{vectorSubjectMutex};
+                            vectorSubject.SetValueA(vectorSubject.GetValueA() + 1);
+                        }
+                    });
+            }
+        };
+
+        BENCHMARK("Benchmark Concurrent Writes - Sharded Subject + Flush")
+        {
+            {
+                std::vector<std::jthread> threads{};
+                for(uint32_t i{0}; i != threadCount; ++i)
+                {
+                    threads.emplace_back(
+                        [&shardedSubject]
+                        {
+                            for(int32_t i{0}; i != writesPerThread; ++i)
+                            {
+                                shardedSubject.AddValueA(1);
+                            }
+                        });
+                }
+            }
+
+            return shardedSubject.Flush();
+        };
+    }
+}
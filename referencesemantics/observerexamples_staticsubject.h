@@ -0,0 +1,168 @@
+#pragma once
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <tuple>
+#include <concepts>
+
+#include "observerexamples_referencesemantics.h"
+
+namespace ReferenceSemantics
+{
+    template<typename ObserverT, typename SubjectT, typename TagT>
+    concept IsStaticObserver = requires(ObserverT& observer, const SubjectT& subject, const TagT tag)
+    {
+        { observer.OnNotification(subject, tag) } -> std::convertible_to<bool>;
+    };
+
+    // Observer set fixed at compile time. Observers are owned by value and notified by a fold expression,
+    // there are no virtual calls so each OnNotification can be inlined into the function sending the notification.
+    template<typename SubjectT, IsScopedEnum TagT, typename... ObserversT>
+    class StaticSubject
+    {
+    public:
+        using Tag = TagT;
+
+        template<size_t IndexT>
+        auto& GetObserver() { return std::get<IndexT>(m_Observers); }
+
+        template<size_t IndexT>
+        const auto& GetObserver() const { return std::get<IndexT>(m_Observers); }
+    protected:
+        void SendNotification(const Tag tag)
+        {
+            static_assert((IsStaticObserver<ObserversT, SubjectT, TagT> && ...));
+
+            std::apply(
+                [this, tag](ObserversT&... observers)
+                {
+                    (observers.OnNotification(static_cast<const SubjectT&>(*this), tag), ...);
+                },
+                m_Observers);
+        }
+    private:
+        std::tuple<ObserversT...> m_Observers{};
+    };
+
+    class StaticSubjectObserverA final
+    {
+    public:
+        template<typename SubjectSystemT>
+        bool OnNotification(const SubjectSystemT& subject, const SubjectSystemTag tag)
+        {
+            if(tag == SubjectSystemTag::ValueA)
+            {
+                m_Value = subject.GetValueA();
+                return true;
+            }
+
+            return false;
+        }
+
+        int32_t GetValue() const { return m_Value; }
+    private:
+        int32_t m_Value{0};
+    };
+
+    class StaticSubjectObserverB final
+    {
+    public:
+        template<typename SubjectSystemT>
+        bool OnNotification(const SubjectSystemT& subject, const SubjectSystemTag tag)
+        {
+            if(tag == SubjectSystemTag::ValueB)
+            {
+                m_Value = subject.GetValueB();
+                return true;
+            }
+
+            return false;
+        }
+
+        int32_t GetValue() const { return m_Value; }
+    private:
+        int32_t m_Value{0};
+    };
+
+    class StaticSubjectSystem final : public StaticSubject<StaticSubjectSystem, SubjectSystemTag,
+        StaticSubjectObserverA, StaticSubjectObserverB, StaticSubjectObserverA, StaticSubjectObserverB>
+    {
+    public:
+        void SetValueA(const int32_t value)
+        {
+            m_ValueA = value;
+            SendNotification(SubjectSystemTag::ValueA);
+        }
+
+        void SetValueB(const int32_t value)
+        {
+            m_ValueB = value;
+            SendNotification(SubjectSystemTag::ValueB);
+        }
+
+        int32_t GetValueA() const { return m_ValueA; }
+        int32_t GetValueB() const { return m_ValueB; }
+    private:
+        int32_t m_ValueA{0};
+        int32_t m_ValueB{0};
+    };
+
+    TEST_CASE("Observer - Reference Semantics - Static Subject Unit Tests")
+    {
+        StaticSubjectSystem subject{};
+        REQUIRE(subject.GetValueA() == 0);
+        REQUIRE(subject.GetValueB() == 0);
+        REQUIRE(subject.GetObserver<0>().GetValue() == 0);
+        REQUIRE(subject.GetObserver<1>().GetValue() == 0);
+        REQUIRE(subject.GetObserver<2>().GetValue() == 0);
+        REQUIRE(subject.GetObserver<3>().GetValue() == 0);
+
+        subject.SetValueA(1);
+
+        REQUIRE(subject.GetValueA() == 1);
+        REQUIRE(subject.GetValueB() == 0);
+        REQUIRE(subject.GetObserver<0>().GetValue() == 1);
+        REQUIRE(subject.GetObserver<1>().GetValue() == 0);
+        REQUIRE(subject.GetObserver<2>().GetValue() == 1);
+        REQUIRE(subject.GetObserver<3>().GetValue() == 0);
+
+        subject.SetValueB(2);
+
+        REQUIRE(subject.GetValueA() == 1);
+        REQUIRE(subject.GetValueB() == 2);
+        REQUIRE(subject.GetObserver<0>().GetValue() == 1);
+        REQUIRE(subject.GetObserver<1>().GetValue() == 2);
+        REQUIRE(subject.GetObserver<2>().GetValue() == 1);
+        REQUIRE(subject.GetObserver<3>().GetValue() == 2);
+    }
+
+    TEST_CASE("Observer - Reference Semantics - Static Subject Benchmarks")
+    {
+        StaticSubjectSystem staticSubject{};
+
+        SubjectSystem subject{};
+        SubjectObserverA observerA{};
+        SubjectObserverB observerB{};
+        SubjectObserverA observerAA{};
+        SubjectObserverB observerBB{};
+        subject.AttachObserver(&observerA);
+        subject.AttachObserver(&observerB);
+        subject.AttachObserver(&observerAA);
+        subject.AttachObserver(&observerBB);
+
+        int32_t value{0};
+
+        BENCHMARK("Benchmark Notification - Subject")
+        {
+            subject.SetValueA(++value);
+            return observerAA.GetValue();
+        };
+
+        BENCHMARK("Benchmark Notification - Static Subject")
+        {
+            staticSubject.SetValueA(++value);
+            return staticSubject.GetObserver<2>().GetValue();
+        };
+    }
+}
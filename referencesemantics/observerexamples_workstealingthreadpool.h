@@ -0,0 +1,233 @@
+#pragma once
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <functional>
+#include <exception>
+#include <stdexcept>
+#include <limits>
+#include <utility>
+
+namespace ReferenceSemantics
+{
+    // Alignment separating data written by different threads. std::hardware_destructive_interference_size is not used
+    // as it may differ between compiler flags, which makes it unsafe in headers.
+    constexpr size_t CacheLineSize{64};
+
+    // Fork/join pool for splitting a range across threads. The calling thread takes part in the work and ParallelFor
+    // returns once every chunk has run. Each thread starts on its own contiguous share of the range and steals chunks
+    // from the other shares once its own is empty. ParallelFor must not be called concurrently or from inside a chunk.
+    class WorkStealingThreadPool
+    {
+    public:
+        explicit WorkStealingThreadPool(const uint32_t threadCount = std::max(std::thread::hardware_concurrency(), 1u))
+            : m_Ranges{std::make_unique<WorkRange[]>(std::max(threadCount, 1u))}
+            , m_ThreadCount{std::max(threadCount, 1u)}
+        {
+            m_Workers.reserve(m_ThreadCount - 1);
+            for(uint32_t i{1}; i != m_ThreadCount; ++i)
+            {
+                m_Workers.emplace_back(
+                    [this, i](const std::stop_token stopToken)
+                    {
+                        WorkerLoop(stopToken, i);
+                    });
+            }
+        }
+
+        ~WorkStealingThreadPool()
+        {
+            for(std::jthread& worker : m_Workers)
+            {
+                worker.request_stop();
+            }
+
+            m_Generation.fetch_add(1);
+            m_Generation.notify_all();
+            m_Workers.clear();
+        }
+
+        WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+        WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+
+        uint32_t GetThreadCount() const { return m_ThreadCount; }
+
+        // Calls func(begin, end) for chunks of at most chunkSize indices covering [0, count). When a chunk throws the
+        // chunks not started yet are skipped, the first exception is rethrown once every thread has finished.
+        template<typename FuncT>
+        void ParallelFor(const size_t count, const size_t chunkSize, FuncT&& func)
+        {
+            if(count == 0)
+            {
+                return;
+            }
+
+            if(m_ThreadCount == 1 || count <= chunkSize)
+            {
+                func(size_t{0}, count);
+                return;
+            }
+
+            m_Context = &func;
+            m_Invoke = [](void* const context, const size_t begin, const size_t end)
+                {
+                    (*static_cast<std::remove_reference_t<FuncT>*>(context))(begin, end);
+                };
+            m_ChunkSize = std::max(chunkSize, size_t{1});
+            m_IsCancelled.store(false, std::memory_order_relaxed);
+
+            const size_t share{(count + m_ThreadCount - 1) / m_ThreadCount};
+            for(uint32_t i{0}; i != m_ThreadCount; ++i)
+            {
+                m_Ranges[i].m_Next.store(std::min(share * i, count), std::memory_order_relaxed);
+                m_Ranges[i].m_End = std::min(share * (i + 1), count);
+            }
+
+            m_PendingWorkers.store(m_ThreadCount - 1);
+            m_Generation.fetch_add(1);
+            m_Generation.notify_all();
+
+            RunRanges(0);
+
+            for(uint32_t pending{m_PendingWorkers.load()}; pending != 0; pending = m_PendingWorkers.load())
+            {
+                m_PendingWorkers.wait(pending);
+            }
+
+            if(m_Exception != nullptr)
+            {
+                std::rethrow_exception(std::exchange(m_Exception, nullptr));
+            }
+        }
+    private:
+        struct alignas(CacheLineSize) WorkRange
+        {
+            std::atomic<size_t> m_Next{0};
+            size_t m_End{0};
+        };
+
+        void WorkerLoop(const std::stop_token stopToken, const uint32_t index)
+        {
+            uint64_t generation{0};
+            while(true)
+            {
+                m_Generation.wait(generation);
+                generation = m_Generation.load();
+                if(stopToken.stop_requested())
+                {
+                    return;
+                }
+
+                RunRanges(index);
+                if(m_PendingWorkers.fetch_sub(1) == 1)
+                {
+                    m_PendingWorkers.notify_one();
+                }
+            }
+        }
+
+        void RunRanges(const uint32_t index)
+        {
+            for(uint32_t i{0}; i != m_ThreadCount; ++i)
+            {
+                WorkRange& range{m_Ranges[(index + i) % m_ThreadCount]};
+                for(size_t begin{range.m_Next.fetch_add(m_ChunkSize)}; begin < range.m_End;
+                    begin = range.m_Next.fetch_add(m_ChunkSize))
+                {
+                    if(m_IsCancelled.load(std::memory_order_relaxed))
+                    {
+                        return;
+                    }
+
+                    try
+                    {
+                        m_Invoke(m_Context, begin, std::min(begin + m_ChunkSize, range.m_End));
+                    }
+                    catch(...)
+                    {
+                        // The caller reads the exception after joining the workers, which orders it after this store.
+                        if(!m_IsCancelled.exchange(true))
+                        {
+                            m_Exception = std::current_exception();
+                        }
+                    }
+                }
+            }
+        }
+
+        std::unique_ptr<WorkRange[]> m_Ranges{};
+        std::vector<std::jthread> m_Workers{};
+        void* m_Context{nullptr};
+        void(*m_Invoke)(void*, size_t, size_t){nullptr};
+        size_t m_ChunkSize{1};
+        std::atomic<bool> m_IsCancelled{false};
+        std::exception_ptr m_Exception{};
+        std::atomic<uint64_t> m_Generation{0};
+        std::atomic<uint32_t> m_PendingWorkers{0};
+        uint32_t m_ThreadCount{1};
+    };
+
+    TEST_CASE("Observer - Reference Semantics - Work Stealing Thread Pool Unit Tests")
+    {
+        SECTION("Chunks")
+        {
+            for(const uint32_t threadCount : {1u, 2u, 4u, 7u})
+            {
+                WorkStealingThreadPool pool{threadCount};
+                REQUIRE(pool.GetThreadCount() == threadCount);
+
+                for(const size_t count : {size_t{0}, size_t{1}, size_t{100}, size_t{10'007}})
+                {
+                    std::vector<std::atomic<uint32_t>> visits(count);
+                    std::atomic<size_t> visited{0};
+                    pool.ParallelFor(count, 64,
+                        [&visits, &visited](const size_t begin, const size_t end)
+                        {
+                            for(size_t i{begin}; i != end; ++i)
+                            {
+                                visits[i].fetch_add(1);
+                            }
+
+                            visited.fetch_add(end - begin);
+                        });
+
+                    REQUIRE(visited.load() == count);
+                    REQUIRE(std::all_of(visits.begin(), visits.end(),
+                        [](const std::atomic<uint32_t>& visit){ return visit.load() == 1; }));
+                }
+            }
+        }
+
+        SECTION("Throwing Chunks")
+        {
+            // One throwing chunk, then every chunk throwing so both the calling thread and the workers throw.
+            WorkStealingThreadPool pool{4};
+            for(const size_t throwingIndex : {size_t{0}, size_t{5'000}, std::numeric_limits<size_t>::max()})
+            {
+                REQUIRE_THROWS_AS(pool.ParallelFor(10'000, 16,
+                    [throwingIndex](const size_t begin, const size_t end)
+                    {
+                        if(throwingIndex == std::numeric_limits<size_t>::max()
+                            || (throwingIndex >= begin && throwingIndex < end))
+                        {
+                            throw std::runtime_error{"Chunk failed"};
+                        }
+                    }), std::runtime_error);
+            }
+
+            std::atomic<size_t> visited{0};
+            pool.ParallelFor(10'000, 16,
+                [&visited](const size_t begin, const size_t end)
+                {
+                    visited.fetch_add(end - begin);
+                });
+
+            REQUIRE(visited.load() == 10'000);
+        }
+    }
+}
@@ -6,17 +6,185 @@
 #include <set>
 #include <memory>
 #include <functional>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+#include <string>
+
+#include "../benchmarks/observerexamples_benchmarkattachdetach.h"
 
 namespace ValueSemantics
 {
     template<typename T>
     concept IsScopedEnum = std::is_scoped_enum_v<T>;
 
-    template<typename SubjectT, IsScopedEnum TagT>
+    template<typename SignatureT, size_t CapacityT = 32, bool IsCopyableT = true>
+    class InplaceFunction;
+
+    // Type erased callable stored inline, never allocates. Callables larger than CapacityT fail to compile.
+    // Invoking is a single indirect call, trivially copyable callables are copied/destroyed without a manager call.
+    template<typename ReturnT, typename... ArgsT, size_t CapacityT, bool IsCopyableT>
+    class InplaceFunction<ReturnT(ArgsT...), CapacityT, IsCopyableT>
+    {
+    public:
+        InplaceFunction() = default;
+
+        template<typename FuncT>
+            requires (!std::same_as<std::decay_t<FuncT>, InplaceFunction>)
+                && std::is_invocable_r_v<ReturnT, std::decay_t<FuncT>&, ArgsT...>
+        InplaceFunction(FuncT&& func)
+        {
+            using CallableT = std::decay_t<FuncT>;
+            static_assert(sizeof(CallableT) <= CapacityT, "Callable exceeds the inline capacity");
+            static_assert(alignof(CallableT) <= alignof(std::max_align_t), "Callable is over aligned");
+            static_assert(std::is_nothrow_move_constructible_v<CallableT>, "Callable must be nothrow move constructible");
+            static_assert(!IsCopyableT || std::is_copy_constructible_v<CallableT>, "Callable must be copy constructible");
+
+            ::new(static_cast<void*>(m_Storage)) CallableT(std::forward<FuncT>(func));
+            m_Invoke = &Invoke<CallableT>;
+            if constexpr(!std::is_trivially_copyable_v<CallableT>)
+            {
+                m_Manage = &Manage<CallableT>;
+            }
+        }
+
+        InplaceFunction(const InplaceFunction& other) requires IsCopyableT
+        {
+            CopyFrom(other);
+        }
+
+        InplaceFunction(InplaceFunction&& other) noexcept
+        {
+            MoveFrom(std::move(other));
+        }
+
+        InplaceFunction& operator=(const InplaceFunction& other) requires IsCopyableT
+        {
+            if(this != &other)
+            {
+                Reset();
+                CopyFrom(other);
+            }
+
+            return *this;
+        }
+
+        InplaceFunction& operator=(InplaceFunction&& other) noexcept
+        {
+            if(this != &other)
+            {
+                Reset();
+                MoveFrom(std::move(other));
+            }
+
+            return *this;
+        }
+
+        ~InplaceFunction()
+        {
+            Reset();
+        }
+
+        ReturnT operator()(ArgsT... args)
+        {
+            return m_Invoke(m_Storage, std::forward<ArgsT>(args)...);
+        }
+
+        explicit operator bool() const { return m_Invoke != nullptr; }
+    private:
+        enum class Operation
+        {
+            Copy,
+            Move,
+            Destroy
+        };
+
+        using InvokeFunc = ReturnT(*)(void*, ArgsT&&...);
+        using ManageFunc = void(*)(Operation, void*, void*);
+
+        template<typename CallableT>
+        static ReturnT Invoke(void* const storage, ArgsT&&... args)
+        {
+            return std::invoke(*static_cast<CallableT*>(storage), std::forward<ArgsT>(args)...);
+        }
+
+        template<typename CallableT>
+        static void Manage(const Operation operation, void* const destination, void* const source)
+        {
+            switch(operation)
+            {
+            case Operation::Copy:
+                if constexpr(IsCopyableT)
+                {
+                    ::new(destination) CallableT(*static_cast<const CallableT*>(source));
+                }
+                break;
+            case Operation::Move:
+                ::new(destination) CallableT(std::move(*static_cast<CallableT*>(source)));
+                static_cast<CallableT*>(source)->~CallableT();
+                break;
+            case Operation::Destroy:
+                static_cast<CallableT*>(destination)->~CallableT();
+                break;
+            }
+        }
+
+        void CopyFrom(const InplaceFunction& other)
+        {
+            if(other.m_Manage)
+            {
+                other.m_Manage(Operation::Copy, m_Storage, const_cast<std::byte*>(other.m_Storage));
+            }
+            else
+            {
+                std::memcpy(m_Storage, other.m_Storage, CapacityT);
+            }
+
+            m_Invoke = other.m_Invoke;
+            m_Manage = other.m_Manage;
+        }
+
+        void MoveFrom(InplaceFunction&& other)
+        {
+            if(other.m_Manage)
+            {
+                other.m_Manage(Operation::Move, m_Storage, other.m_Storage);
+            }
+            else
+            {
+                std::memcpy(m_Storage, other.m_Storage, CapacityT);
+            }
+
+            m_Invoke = std::exchange(other.m_Invoke, nullptr);
+            m_Manage = std::exchange(other.m_Manage, nullptr);
+        }
+
+        void Reset()
+        {
+            if(m_Manage)
+            {
+                m_Manage(Operation::Destroy, m_Storage, nullptr);
+            }
+
+            m_Invoke = nullptr;
+            m_Manage = nullptr;
+        }
+
+        alignas(std::max_align_t) std::byte m_Storage[CapacityT]{};
+        InvokeFunc m_Invoke{nullptr};
+        ManageFunc m_Manage{nullptr};
+    };
+
+    template<typename SignatureT>
+    using MoveOnlyInplaceFunction = InplaceFunction<SignatureT, 32, false>;
+
+    template<typename SubjectT, IsScopedEnum TagT, template<typename> typename FunctionT = InplaceFunction>
     class Observer
     {
     public:
-        using OnNotificationFunc = std::function<bool(const SubjectT&, TagT)>;
+        using OnNotificationFunc = FunctionT<bool(const SubjectT&, TagT)>;
 
         explicit Observer(OnNotificationFunc&& func)
             : m_OnNotification{std::move(func)}
@@ -31,11 +199,11 @@ namespace ValueSemantics
         OnNotificationFunc m_OnNotification{};
     };
 
-    template<typename SubjectT, IsScopedEnum TagT>
+    template<typename SubjectT, IsScopedEnum TagT, template<typename> typename FunctionT = InplaceFunction>
     class Subject
     {
     public:
-        using Observer = Observer<SubjectT, TagT>;
+        using Observer = Observer<SubjectT, TagT, FunctionT>;
         using Tag = TagT;
 
         void AttachObserver(Observer* const observer)
@@ -65,19 +233,20 @@ namespace ValueSemantics
         ValueB,
     };
 
-    class SubjectSystem final : public Subject<SubjectSystem, SubjectSystemTag>
+    template<template<typename> typename FunctionT>
+    class BasicSubjectSystem final : public Subject<BasicSubjectSystem<FunctionT>, SubjectSystemTag, FunctionT>
     {
     public:
         void SetValueA(const int32_t value)
         {
             m_ValueA = value;
-            SendNotification(SubjectSystemTag::ValueA);
+            this->SendNotification(SubjectSystemTag::ValueA);
         }
 
         void SetValueB(const int32_t value)
         {
             m_ValueB = value;
-            SendNotification(SubjectSystemTag::ValueB);
+            this->SendNotification(SubjectSystemTag::ValueB);
         }
 
         int32_t GetValueA() const{ return m_ValueA; }
@@ -87,14 +256,18 @@ namespace ValueSemantics
         int32_t m_ValueB{0};
     };
 
-    class SubjectObserverA final : public SubjectSystem::Observer
+    using SubjectSystem = BasicSubjectSystem<InplaceFunction>;
+    using StdFunctionSubjectSystem = BasicSubjectSystem<std::function>;
+
+    template<typename SubjectSystemT>
+    class BasicSubjectObserverA final : public SubjectSystemT::Observer
     {
     public:
-        SubjectObserverA()
-            : SubjectSystem::Observer{
-                [&value{m_Value}](const SubjectSystem& subject, const SubjectSystem::Tag tag)
+        BasicSubjectObserverA()
+            : SubjectSystemT::Observer{
+                [&value{m_Value}](const SubjectSystemT& subject, const typename SubjectSystemT::Tag tag)
                 {
-                    if(tag == SubjectSystem::Tag::ValueA)
+                    if(tag == SubjectSystemT::Tag::ValueA)
                     {
                         value = subject.GetValueA();
                         return true;
@@ -110,13 +283,17 @@ namespace ValueSemantics
         int32_t m_Value{0};
     };
 
+    using SubjectObserverA = BasicSubjectObserverA<SubjectSystem>;
+
     namespace
     {
         constexpr uint32_t creationCount{250'000};
         int32_t freeFuncValueB{0};
-        bool OnNotification(const SubjectSystem& subject, const SubjectSystem::Tag tag)
+
+        template<typename SubjectSystemT>
+        bool OnNotification(const SubjectSystemT& subject, const typename SubjectSystemT::Tag tag)
         {
-            if(tag == SubjectSystem::Tag::ValueB)
+            if(tag == SubjectSystemT::Tag::ValueB)
             {
                 freeFuncValueB = subject.GetValueB();
                 return true;
@@ -145,7 +322,7 @@ namespace ValueSemantics
             }};
 
         freeFuncValueB = 0;
-        SubjectSystem::Observer observerBB{OnNotification};
+        SubjectSystem::Observer observerBB{OnNotification<SubjectSystem>};
 
         REQUIRE(subject.GetValueA() == 0);
         REQUIRE(subject.GetValueB() == 0);
@@ -190,25 +367,61 @@ namespace ValueSemantics
         REQUIRE(freeFuncValueB == 2);
     }
 
+    TEST_CASE("Observer - Value Semantics - Inplace Function Unit Tests")
+    {
+        int32_t value{0};
+        InplaceFunction<int32_t(int32_t)> add{[&value](const int32_t increment){ return value += increment; }};
+        REQUIRE(add);
+        REQUIRE(add(1) == 1);
+
+        InplaceFunction<int32_t(int32_t)> copy{add};
+        REQUIRE(copy(2) == 3);
+
+        InplaceFunction<int32_t(int32_t)> moved{std::move(copy)};
+        REQUIRE_FALSE(copy);
+        REQUIRE(moved(3) == 6);
+
+        std::shared_ptr<int32_t> shared{std::make_shared<int32_t>(10)};
+        InplaceFunction<int32_t()> sharedFunc{[shared]{ return *shared; }};
+        REQUIRE(shared.use_count() == 2);
+        {
+            InplaceFunction<int32_t()> sharedCopy{sharedFunc};
+            REQUIRE(shared.use_count() == 3);
+            REQUIRE(sharedCopy() == 10);
+        }
+        REQUIRE(shared.use_count() == 2);
+
+        sharedFunc = InplaceFunction<int32_t()>{[]{ return 0; }};
+        REQUIRE(shared.use_count() == 1);
+        REQUIRE(sharedFunc() == 0);
+
+        MoveOnlyInplaceFunction<int32_t()> moveOnly{[unique{std::make_unique<int32_t>(20)}]{ return *unique; }};
+        MoveOnlyInplaceFunction<int32_t()> moveOnlyMoved{std::move(moveOnly)};
+        REQUIRE_FALSE(moveOnly);
+        REQUIRE(moveOnlyMoved() == 20);
+        STATIC_REQUIRE_FALSE(std::is_copy_constructible_v<MoveOnlyInplaceFunction<int32_t()>>);
+
+        InplaceFunction<bool(const SubjectSystem&, SubjectSystemTag), 48> large{OnNotification<SubjectSystem>};
+        STATIC_REQUIRE(sizeof(large) > sizeof(InplaceFunction<bool(const SubjectSystem&, SubjectSystemTag)>));
+    }
+
     TEST_CASE("Observer - Value Semantics - Benchmarks Object")
     {
         SubjectSystem subject{};
         std::vector<std::shared_ptr<SubjectSystem::Observer>> observers{};
-        observers.reserve(creationCount);
-        for(uint32_t i{0}; i != creationCount; ++i)
+        observers.reserve(creationCount + creationCount / 10);
+        for(uint32_t i{0}; i != creationCount + creationCount / 10; ++i)
         {
             std::shared_ptr<SubjectSystem::Observer> observer{std::make_unique<SubjectObserverA>()};
             observers.push_back(observer);
-            subject.AttachObserver(observer.get());
         }
 
-        BENCHMARK("Benchmark Attach")
+        for(uint32_t i{0}; i != creationCount; ++i)
         {
-            for(std::shared_ptr<SubjectSystem::Observer>& observer : observers)
-            {
-                subject.AttachObserver(observer.get());
-            }
-        };
+            subject.AttachObserver(observers[i].get());
+        }
+
+        Benchmarks::BenchmarkAttachDetach<SubjectSystem>("", observers, creationCount);
 
         BENCHMARK("Benchmark Notification")
         {
@@ -219,10 +432,10 @@ namespace ValueSemantics
     TEST_CASE("Observer - Value Semantics - Benchmarks Lambda")
     {
         int32_t value{0};
-        SubjectSystem::Observer observerLambda{
-            [&value](const SubjectSystem& subject, const SubjectSystem::Tag tag)
+        const auto lambda{
+            [&value]<typename SubjectSystemT>(const SubjectSystemT& subject, const SubjectSystemTag tag)
             {
-                if(tag == SubjectSystem::Tag::ValueB)
+                if(tag == SubjectSystemTag::ValueB)
                 {
                     value = subject.GetValueB();
                     return true;
@@ -230,55 +443,86 @@ namespace ValueSemantics
 
                 return false;
             }};
+        SubjectSystem::Observer observerLambda{lambda};
 
         SubjectSystem subject{};
         std::vector<std::shared_ptr<SubjectSystem::Observer>> observers{};
-        observers.reserve(creationCount);
-        for(uint32_t i{0}; i != creationCount; ++i)
+        observers.reserve(creationCount + creationCount / 10);
+        for(uint32_t i{0}; i != creationCount + creationCount / 10; ++i)
         {
             std::shared_ptr<SubjectSystem::Observer> observer{std::make_unique<SubjectSystem::Observer>(observerLambda)};
             observers.push_back(observer);
-            subject.AttachObserver(observer.get());
         }
 
-        BENCHMARK("Benchmark Attach")
+        for(uint32_t i{0}; i != creationCount; ++i)
         {
-            for(std::shared_ptr<SubjectSystem::Observer>& observer : observers)
-            {
-                subject.AttachObserver(observer.get());
-            }
-        };
+            subject.AttachObserver(observers[i].get());
+        }
+
+        Benchmarks::BenchmarkAttachDetach<SubjectSystem>("", observers, creationCount);
 
         BENCHMARK("Benchmark Notification")
         {
             subject.SetValueA(0);
         };
+
+        StdFunctionSubjectSystem::Observer stdObserverLambda{lambda};
+        StdFunctionSubjectSystem stdSubject{};
+        std::vector<std::shared_ptr<StdFunctionSubjectSystem::Observer>> stdObservers{};
+        stdObservers.reserve(creationCount);
+        for(uint32_t i{0}; i != creationCount; ++i)
+        {
+            std::shared_ptr<StdFunctionSubjectSystem::Observer> observer{
+                std::make_unique<StdFunctionSubjectSystem::Observer>(stdObserverLambda)};
+            stdObservers.push_back(observer);
+            stdSubject.AttachObserver(observer.get());
+        }
+
+        BENCHMARK("Benchmark Notification - std::function")
+        {
+            stdSubject.SetValueA(0);
+        };
     }
 
     TEST_CASE("Observer - Value Semantics - Benchmarks Free Function")
     {
-        SubjectSystem::Observer observerFreeFunction{OnNotification};
+        SubjectSystem::Observer observerFreeFunction{OnNotification<SubjectSystem>};
         SubjectSystem subject{};
         std::vector<std::shared_ptr<SubjectSystem::Observer>> observers{};
-        observers.reserve(creationCount);
-        for(uint32_t i{0}; i != creationCount; ++i)
+        observers.reserve(creationCount + creationCount / 10);
+        for(uint32_t i{0}; i != creationCount + creationCount / 10; ++i)
         {
             std::shared_ptr<SubjectSystem::Observer> observer{std::make_unique<SubjectSystem::Observer>(observerFreeFunction)};
             observers.push_back(observer);
-            subject.AttachObserver(observer.get());
         }
 
-        BENCHMARK("Benchmark Attach")
+        for(uint32_t i{0}; i != creationCount; ++i)
         {
-            for(std::shared_ptr<SubjectSystem::Observer>& observer : observers)
-            {
-                subject.AttachObserver(observer.get());
-            }
-        };
+            subject.AttachObserver(observers[i].get());
+        }
+
+        Benchmarks::BenchmarkAttachDetach<SubjectSystem>("", observers, creationCount);
 
         BENCHMARK("Benchmark Notification")
         {
             subject.SetValueA(0);
         };
+
+        StdFunctionSubjectSystem::Observer stdObserverFreeFunction{OnNotification<StdFunctionSubjectSystem>};
+        StdFunctionSubjectSystem stdSubject{};
+        std::vector<std::shared_ptr<StdFunctionSubjectSystem::Observer>> stdObservers{};
+        stdObservers.reserve(creationCount);
+        for(uint32_t i{0}; i != creationCount; ++i)
+        {
+            std::shared_ptr<StdFunctionSubjectSystem::Observer> observer{
+                std::make_unique<StdFunctionSubjectSystem::Observer>(stdObserverFreeFunction)};
+            stdObservers.push_back(observer);
+            stdSubject.AttachObserver(observer.get());
+        }
+
+        BENCHMARK("Benchmark Notification - std::function")
+        {
+            stdSubject.SetValueA(0);
+        };
     }
 }